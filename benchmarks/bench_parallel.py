@@ -0,0 +1,64 @@
+import os
+import timeit
+import argparse
+import numpy as np
+import pandas as pd
+import screamer
+
+
+# Panels are (time x instruments), each column is an independent series
+panel_cases = {
+    'RollingMean': lambda: screamer.RollingMean(window_size=100),
+    'EwStd': lambda: screamer.EwStd(span=100),
+    'RollingQuantile': lambda: screamer.RollingQuantile(window_size=100, quantile=0.75),
+}
+
+thread_counts = [1, 2, 4, 8, 0]
+
+
+def time_panel(factory, panel, n_threads, repeat):
+    obj = factory()
+    times = timeit.repeat(lambda: obj(panel, n_threads=n_threads), number=1, repeat=repeat)
+    return min(times)
+
+
+def main():
+    parser = argparse.ArgumentParser(description="Benchmark column-parallel processing of panels.")
+    parser.add_argument("--rows", type=int, default=100_000, help="number of time steps")
+    parser.add_argument("--cols", type=int, default=200, help="number of instruments")
+    parser.add_argument("--repeat", type=int, default=5, help="number of repeats")
+    cmd_args = parser.parse_args()
+
+    panel = np.random.normal(size=(cmd_args.rows, cmd_args.cols))
+
+    results = []
+    for name, factory in panel_cases.items():
+        print(name + ' ', end="", flush=True)
+        t_serial = None
+        for n_threads in thread_counts:
+            t = time_panel(factory, panel, n_threads, cmd_args.repeat)
+            if t_serial is None:
+                t_serial = t
+            results.append({
+                'func': name,
+                'rows': cmd_args.rows,
+                'cols': cmd_args.cols,
+                'n_threads': n_threads if n_threads > 0 else os.cpu_count(),
+                'time': t,
+                'speedup': t_serial / t
+            })
+            print('.', end='', flush=True)
+        print(' done.')
+
+    results = pd.DataFrame(results)
+    print(results.to_string(index=False))
+
+    # Save to disk next to the other experiments
+    script_dir = os.path.dirname(os.path.abspath(__file__))
+    save_path = os.path.join(script_dir, 'experiments', 'bm_parallel__panels.csv')
+    results.to_csv(save_path, index=False)
+
+
+# Entry point for the script
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,71 @@
+import os
+import timeit
+import argparse
+import numpy as np
+import pandas as pd
+import screamer
+
+
+# Objects with a cheap O(1) update, so the call overhead dominates
+scalar_cases = {
+    'EwMean': lambda: screamer.EwMean(span=100),
+    'RollingMean': lambda: screamer.RollingMean(window_size=100),
+}
+
+# Scalar types arriving from a live feed
+value_cases = {
+    'float': 1.5,
+    'int': 2,
+    'numpy.float64': np.float64(1.5),
+    'numpy.float32': np.float32(1.5),
+    'numpy.int64': np.int64(2),
+}
+
+
+def ns_per_call(func, value, number, repeat):
+    times = timeit.repeat(lambda: func(value), number=number, repeat=repeat)
+    return 1e9 * min(times) / number
+
+
+def main():
+    parser = argparse.ArgumentParser(description="Benchmark the per-call overhead of scalar updates.")
+    parser.add_argument("--number", type=int, default=100_000, help="number of calls per repeat")
+    parser.add_argument("--repeat", type=int, default=5, help="number of repeats")
+    cmd_args = parser.parse_args()
+
+    results = []
+    for name, factory in scalar_cases.items():
+        print(name + ' ', end="", flush=True)
+        obj = factory()
+        for value_type, value in value_cases.items():
+            for method in ['__call__', 'update']:
+                func = getattr(obj, method)
+                results.append({
+                    'func': name,
+                    'method': method,
+                    'value_type': value_type,
+                    'ns_per_call': ns_per_call(func, value, cmd_args.number, cmd_args.repeat)
+                })
+                print('.', end='', flush=True)
+        print(' done.')
+
+    # Reference: the cost of calling an empty Python function
+    results.append({
+        'func': 'python',
+        'method': 'lambda',
+        'value_type': 'float',
+        'ns_per_call': ns_per_call(lambda x: x, 1.5, cmd_args.number, cmd_args.repeat)
+    })
+
+    results = pd.DataFrame(results)
+    print(results.to_string(index=False))
+
+    # Save to disk next to the other experiments
+    script_dir = os.path.dirname(os.path.abspath(__file__))
+    save_path = os.path.join(script_dir, 'experiments', 'bm_scalar__calls.csv')
+    results.to_csv(save_path, index=False)
+
+
+# Entry point for the script
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,109 @@
+// Compare the per-element virtual dispatch of ScreamerBase with the inlined
+// ScreamerKernel step loop. Both loops are called explicitly, so operators
+// with their own array kernels, like the WindowSums kernels of the rolling
+// moments, are measured on the step loop too.
+//
+// Reports nanoseconds per element for
+//   virtual: ScreamerBase::process_array_no_stride, a virtual process_scalar call per element
+//   kernel:  ScreamerKernel<Derived>::array_no_stride, Derived::step inlined in the loop
+
+#include <pybind11/embed.h>
+
+#include <chrono>
+#include <cstdio>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "screamer/ew_kurt.h"
+#include "screamer/ew_skew.h"
+#include "screamer/ew_std.h"
+#include "screamer/ew_var.h"
+#include "screamer/rolling_fracdiff.h"
+#include "screamer/rolling_kurt.h"
+#include "screamer/rolling_max.h"
+#include "screamer/rolling_median.h"
+#include "screamer/rolling_min.h"
+#include "screamer/rolling_ou.h"
+#include "screamer/rolling_poly1.h"
+#include "screamer/rolling_poly2.h"
+#include "screamer/rolling_quantile.h"
+#include "screamer/rolling_rsi.h"
+#include "screamer/rolling_skew.h"
+#include "screamer/rolling_std.h"
+#include "screamer/rolling_var.h"
+#include "screamer/rolling_zscore.h"
+
+using screamer::ScreamerBase;
+
+namespace {
+
+    __attribute__((noinline))
+    void run_virtual(ScreamerBase& obj, double* y, const double* x, size_t n) {
+        obj.reset();
+        obj.ScreamerBase::process_array_no_stride(y, x, n);
+    }
+
+    template <typename Derived>
+    __attribute__((noinline))
+    void run_kernel(Derived& obj, double* y, const double* x, size_t n) {
+        obj.reset();
+        obj.screamer::ScreamerKernel<Derived>::template array_no_stride<double>(y, x, n);
+    }
+
+    template <typename Obj, typename Run>
+    double ns_per_element(Run run, Obj& obj, double* y, const double* x, size_t n, int repeats) {
+        double best = 1e300;
+        for (int r = 0; r < repeats; r++) {
+            auto start = std::chrono::steady_clock::now();
+            run(obj, y, x, n);
+            auto stop = std::chrono::steady_clock::now();
+            double ns = std::chrono::duration<double, std::nano>(stop - start).count();
+            if (ns < best) best = ns;
+        }
+        return best / n;
+    }
+
+    template <typename Derived>
+    void bench(const std::string& name, Derived&& obj, const std::vector<double>& x, int repeats) {
+        std::vector<double> y(x.size());
+        double t_virtual = ns_per_element(run_virtual, static_cast<ScreamerBase&>(obj), y.data(), x.data(), x.size(), repeats);
+        double t_kernel = ns_per_element(run_kernel<Derived>, obj, y.data(), x.data(), x.size(), repeats);
+        std::printf("%-20s %10.2f %10.2f %8.2fx\n", name.c_str(), t_virtual, t_kernel, t_virtual / t_kernel);
+    }
+
+}
+
+int main(int argc, char** argv) {
+    size_t n = argc > 1 ? std::stoul(argv[1]) : 1000000;
+    int repeats = argc > 2 ? std::stoi(argv[2]) : 5;
+
+    std::vector<double> x(n);
+    std::mt19937_64 rng(42);
+    std::normal_distribution<double> normal;
+    for (auto& v : x) v = normal(rng);
+
+    std::printf("%-20s %10s %10s %9s\n", "operator", "virtual", "kernel", "speedup");
+    std::printf("%-20s %10s %10s %9s\n", "", "ns/elem", "ns/elem", "");
+
+    bench("RollingSkew",     screamer::RollingSkew(20), x, repeats);
+    bench("RollingKurt",     screamer::RollingKurt(20), x, repeats);
+    bench("RollingVar",      screamer::RollingVar(20), x, repeats);
+    bench("RollingStd",      screamer::RollingStd(20), x, repeats);
+    bench("RollingZscore",   screamer::RollingZscore(20), x, repeats);
+    bench("RollingMin",      screamer::RollingMin(20), x, repeats);
+    bench("RollingMax",      screamer::RollingMax(20), x, repeats);
+    bench("RollingMedian",   screamer::RollingMedian(20), x, repeats);
+    bench("RollingQuantile", screamer::RollingQuantile(20, 0.25), x, repeats);
+    bench("RollingRSI",      screamer::RollingRSI(20), x, repeats);
+    bench("RollingOU",       screamer::RollingOU(20), x, repeats);
+    bench("RollingPoly1",    screamer::RollingPoly1(20), x, repeats);
+    bench("RollingPoly2",    screamer::RollingPoly2(20), x, repeats);
+    bench("RollingFracDiff", screamer::RollingFracDiff(0.5, 20), x, repeats);
+    bench("EwSkew",          screamer::EwSkew(20.0), x, repeats);
+    bench("EwKurt",          screamer::EwKurt(20.0), x, repeats);
+    bench("EwVar",           screamer::EwVar(20.0), x, repeats);
+    bench("EwStd",           screamer::EwStd(20.0), x, repeats);
+
+    return 0;
+}
@@ -0,0 +1,77 @@
+// Compare the order statistic structures used by the rolling quantiles on a
+// sliding window: every step erases the oldest value, inserts a new value and
+// reads the 25% quantile.
+//
+// Reports nanoseconds per step for
+//   multiset: std::multiset with std::next to the k-th element
+//   tree:     OrderStatisticTree, an AVL tree of pooled nodes
+//   blocks:   SortedBlocks, sorted blocks in a contiguous pool
+
+#include <chrono>
+#include <cstdio>
+#include <iterator>
+#include <random>
+#include <set>
+#include <string>
+#include <vector>
+
+#include "screamer/common/order_statistic_tree.h"
+#include "screamer/common/sorted_blocks.h"
+
+namespace {
+
+    struct MultisetAdapter {
+        explicit MultisetAdapter(int) {}
+        void insert(double key) { values.insert(key); }
+        void erase(double key) { values.erase(values.find(key)); }
+        double kth_element(int k) const { return *std::next(values.begin(), k); }
+        std::multiset<double> values;
+    };
+
+    template <typename OST>
+    double ns_per_step(const std::vector<double>& x, int window, size_t steps) {
+        OST ost(window);
+        for (int i = 0; i < window; i++) {
+            ost.insert(x[i]);
+        }
+        int k = window / 4;
+        double sink = 0.0;
+
+        auto start = std::chrono::steady_clock::now();
+        for (size_t i = window; i < window + steps; i++) {
+            ost.erase(x[i - window]);
+            ost.insert(x[i]);
+            sink += ost.kth_element(k);
+        }
+        auto stop = std::chrono::steady_clock::now();
+
+        if (sink == 42.0) std::printf(" ");
+        return std::chrono::duration<double, std::nano>(stop - start).count() / steps;
+    }
+
+}
+
+int main(int argc, char** argv) {
+    size_t steps = argc > 1 ? std::stoul(argv[1]) : 1000000;
+    bool run_multiset = argc > 2 ? std::stoi(argv[2]) != 0 : true;
+
+    std::printf("%-10s %10s %10s %10s %9s\n", "window", "multiset", "tree", "blocks", "speedup");
+    std::printf("%-10s %10s %10s %10s %9s\n", "", "ns/step", "ns/step", "ns/step", "tree");
+
+    for (int window : {10, 100, 1000, 10000, 100000}) {
+        std::vector<double> x(window + steps);
+        std::mt19937_64 rng(42);
+        std::normal_distribution<double> normal;
+        for (auto& v : x) v = normal(rng);
+
+        // The multiset walks k nodes per step, skip it for large windows
+        double t_multiset = (run_multiset && window <= 1000)
+            ? ns_per_step<MultisetAdapter>(x, window, steps) : 0.0;
+        double t_tree = ns_per_step<screamer::OrderStatisticTree>(x, window, steps);
+        double t_blocks = ns_per_step<screamer::SortedBlocks>(x, window, steps);
+
+        std::printf("%-10d %10.1f %10.1f %10.1f %8.2fx\n", window, t_multiset, t_tree, t_blocks, t_tree / t_blocks);
+    }
+
+    return 0;
+}
@@ -13,6 +13,7 @@ void init_bindings_preprocessing(py::module& m);
 void init_bindings_signal(py::module& m);
 void init_bindings_fin(py::module& m);
 void init_bindings_misc(py::module& m);
+void init_bindings_bank(py::module& m);
 
 PYBIND11_MODULE(screamer_bindings, m) {
     init_bindings_core(m);
@@ -23,4 +24,5 @@ PYBIND11_MODULE(screamer_bindings, m) {
     init_bindings_signal(m);
     init_bindings_fin(m);
     init_bindings_misc(m);
+    init_bindings_bank(m);
 }
\ No newline at end of file
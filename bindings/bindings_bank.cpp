@@ -0,0 +1,100 @@
+#include <pybind11/pybind11.h>
+#include <pybind11/stl.h> // Required for std::optional support
+#include "screamer/common/bank.h"
+#include "screamer/ew_mean_bank.h"
+#include "screamer/ew_var_bank.h"
+#include "screamer/ew_std_bank.h"
+#include "screamer/rolling_sum_bank.h"
+#include "screamer/rolling_mean_bank.h"
+#include "screamer/rolling_zscore_bank.h"
+
+namespace py = pybind11;
+
+void init_bindings_bank(py::module& m) {
+
+     py::class_<screamer::ScreamerBank>(m, "_ScreamerBank");
+
+     py::class_<screamer::EwMeanBank, screamer::ScreamerBank>(m, "EwMeanBank")
+        .def(
+          py::init<
+               int,
+               std::optional<double>,
+               std::optional<double>,
+               std::optional<double>,
+               std::optional<double>
+          >(),
+          py::arg("n"),
+          py::arg("com") = std::nullopt,
+          py::arg("span") = std::nullopt,
+          py::arg("halflife") = std::nullopt,
+          py::arg("alpha") = std::nullopt
+        )
+        .def("__call__", &screamer::EwMeanBank::operator(), py::arg("value"))
+        .def("__len__", &screamer::EwMeanBank::size)
+        .def("reset", &screamer::EwMeanBank::reset, "Reset to the initial state.");
+
+     py::class_<screamer::EwVarBank, screamer::ScreamerBank>(m, "EwVarBank")
+        .def(
+          py::init<
+               int,
+               std::optional<double>,
+               std::optional<double>,
+               std::optional<double>,
+               std::optional<double>
+          >(),
+          py::arg("n"),
+          py::arg("com") = std::nullopt,
+          py::arg("span") = std::nullopt,
+          py::arg("halflife") = std::nullopt,
+          py::arg("alpha") = std::nullopt
+        )
+        .def("__call__", &screamer::EwVarBank::operator(), py::arg("value"))
+        .def("__len__", &screamer::EwVarBank::size)
+        .def("reset", &screamer::EwVarBank::reset, "Reset to the initial state.");
+
+     py::class_<screamer::EwStdBank, screamer::ScreamerBank>(m, "EwStdBank")
+        .def(
+          py::init<
+               int,
+               std::optional<double>,
+               std::optional<double>,
+               std::optional<double>,
+               std::optional<double>
+          >(),
+          py::arg("n"),
+          py::arg("com") = std::nullopt,
+          py::arg("span") = std::nullopt,
+          py::arg("halflife") = std::nullopt,
+          py::arg("alpha") = std::nullopt
+        )
+        .def("__call__", &screamer::EwStdBank::operator(), py::arg("value"))
+        .def("__len__", &screamer::EwStdBank::size)
+        .def("reset", &screamer::EwStdBank::reset, "Reset to the initial state.");
+
+     py::class_<screamer::RollingSumBank, screamer::ScreamerBank>(m, "RollingSumBank")
+        .def(py::init<int, int, const std::string&>(),
+            py::arg("n"),
+            py::arg("window_size"),
+            py::arg("start_policy") = "strict")
+        .def("__call__", &screamer::RollingSumBank::operator(), py::arg("value"))
+        .def("__len__", &screamer::RollingSumBank::size)
+        .def("reset", &screamer::RollingSumBank::reset, "Reset to the initial state.");
+
+     py::class_<screamer::RollingMeanBank, screamer::ScreamerBank>(m, "RollingMeanBank")
+        .def(py::init<int, int, const std::string&>(),
+            py::arg("n"),
+            py::arg("window_size"),
+            py::arg("start_policy") = "strict")
+        .def("__call__", &screamer::RollingMeanBank::operator(), py::arg("value"))
+        .def("__len__", &screamer::RollingMeanBank::size)
+        .def("reset", &screamer::RollingMeanBank::reset, "Reset to the initial state.");
+
+     py::class_<screamer::RollingZscoreBank, screamer::ScreamerBank>(m, "RollingZscoreBank")
+        .def(py::init<int, int>(),
+            py::arg("n"),
+            py::arg("window_size"))
+        .def("__call__", &screamer::RollingZscoreBank::operator(), py::arg("value"))
+        .def("__len__", &screamer::RollingZscoreBank::size)
+        .def("reset", &screamer::RollingZscoreBank::reset, "Reset to the initial state.");
+
+}
@@ -1,6 +1,8 @@
 #include <pybind11/pybind11.h>
 #include <pybind11/stl.h> // Required for std::optional support
 #include "screamer/common/base.h"
+#include "screamer/common/base2.h"
+#include "screamer/common/regression.h"
 
 namespace py = pybind11;
 
@@ -12,4 +14,12 @@ void init_bindings_core(py::module& m) {
         .def("__iter__", &screamer::ScreamerBase::LazyIterator::__iter__, py::return_value_policy::reference_internal)
         .def("__next__", &screamer::ScreamerBase::LazyIterator::__next__);
 
+    py::class_<screamer::ScreamerBase2>(m, "_ScreamerBase2");
+
+    py::class_<screamer::ScreamerBase2::LazyIterator>(m, "_LazyIterator2")
+        .def("__iter__", &screamer::ScreamerBase2::LazyIterator::__iter__, py::return_value_policy::reference_internal)
+        .def("__next__", &screamer::ScreamerBase2::LazyIterator::__next__);
+
+    py::class_<screamer::ScreamerRegression>(m, "_ScreamerRegression");
+
 }
\ No newline at end of file
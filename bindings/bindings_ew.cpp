@@ -7,13 +7,17 @@
 #include "screamer/ew_zscore.h"
 #include "screamer/ew_skew.h"
 #include "screamer/ew_kurt.h"
+#include "screamer/ew_moments.h"
+#include "screamer/ew_cov.h"
+#include "screamer/ew_corr.h"
+#include "screamer/ew_rls.h"
 #include "screamer/ew_rms.h"
 
 namespace py = pybind11;
 
 void init_bindings_ew(py::module& m) {
 
-     py::class_<screamer::EwMean>(m, "EwMean")
+     py::class_<screamer::EwMean, screamer::ScreamerBase>(m, "EwMean")
         .def(
           py::init<
                std::optional<double>,
@@ -26,10 +30,12 @@ void init_bindings_ew(py::module& m) {
           py::arg("halflife") = std::nullopt,
           py::arg("alpha") = std::nullopt
         )
-        .def("__call__", &screamer::EwMean::operator(), py::arg("value"))
+        .def("__call__", &screamer::EwMean::operator(), py::arg("value"), py::arg("n_threads") = 1, py::arg("out") = py::none())
+        .def("update", py::overload_cast<double>(&screamer::EwMean::update), py::arg("value"))
+        .def("update", py::overload_cast<py::object, py::object>(&screamer::EwMean::update), py::arg("value"), py::arg("out") = py::none())
         .def("reset", &screamer::EwMean::reset, "Reset to the initial state.");
 
-     py::class_<screamer::EwVar>(m, "EwVar")
+     py::class_<screamer::EwVar, screamer::ScreamerBase>(m, "EwVar")
         .def(
           py::init<
                std::optional<double>,
@@ -42,11 +48,13 @@ void init_bindings_ew(py::module& m) {
           py::arg("halflife") = std::nullopt,
           py::arg("alpha") = std::nullopt
         )
-        .def("__call__", &screamer::EwVar::operator(), py::arg("value"))
+        .def("__call__", &screamer::EwVar::operator(), py::arg("value"), py::arg("n_threads") = 1, py::arg("out") = py::none())
+        .def("update", py::overload_cast<double>(&screamer::EwVar::update), py::arg("value"))
+        .def("update", py::overload_cast<py::object, py::object>(&screamer::EwVar::update), py::arg("value"), py::arg("out") = py::none())
         .def("reset", &screamer::EwVar::reset, "Reset to the initial state.");
 
      
-     py::class_<screamer::EwStd>(m, "EwStd")
+     py::class_<screamer::EwStd, screamer::ScreamerBase>(m, "EwStd")
         .def(
           py::init<
                std::optional<double>,
@@ -59,11 +67,13 @@ void init_bindings_ew(py::module& m) {
           py::arg("halflife") = std::nullopt,
           py::arg("alpha") = std::nullopt
         )
-        .def("__call__", &screamer::EwStd::operator(), py::arg("value"))
+        .def("__call__", &screamer::EwStd::operator(), py::arg("value"), py::arg("n_threads") = 1, py::arg("out") = py::none())
+        .def("update", py::overload_cast<double>(&screamer::EwStd::update), py::arg("value"))
+        .def("update", py::overload_cast<py::object, py::object>(&screamer::EwStd::update), py::arg("value"), py::arg("out") = py::none())
         .def("reset", &screamer::EwStd::reset, "Reset to the initial state.");
 
      
-     py::class_<screamer::EwZscore>(m, "EwZscore")
+     py::class_<screamer::EwZscore, screamer::ScreamerBase>(m, "EwZscore")
         .def(
           py::init<
                std::optional<double>,
@@ -76,11 +86,13 @@ void init_bindings_ew(py::module& m) {
           py::arg("halflife") = std::nullopt,
           py::arg("alpha") = std::nullopt
         )
-        .def("__call__", &screamer::EwZscore::operator(), py::arg("value"))
+        .def("__call__", &screamer::EwZscore::operator(), py::arg("value"), py::arg("n_threads") = 1, py::arg("out") = py::none())
+        .def("update", py::overload_cast<double>(&screamer::EwZscore::update), py::arg("value"))
+        .def("update", py::overload_cast<py::object, py::object>(&screamer::EwZscore::update), py::arg("value"), py::arg("out") = py::none())
         .def("reset", &screamer::EwZscore::reset, "Reset to the initial state.");
 
 
-     py::class_<screamer::EwSkew>(m, "EwSkew")
+     py::class_<screamer::EwSkew, screamer::ScreamerBase>(m, "EwSkew")
         .def(
           py::init<
                std::optional<double>,
@@ -93,11 +105,13 @@ void init_bindings_ew(py::module& m) {
           py::arg("halflife") = std::nullopt,
           py::arg("alpha") = std::nullopt
         )
-        .def("__call__", &screamer::EwSkew::operator(), py::arg("value"))
+        .def("__call__", &screamer::EwSkew::operator(), py::arg("value"), py::arg("n_threads") = 1, py::arg("out") = py::none())
+        .def("update", py::overload_cast<double>(&screamer::EwSkew::update), py::arg("value"))
+        .def("update", py::overload_cast<py::object, py::object>(&screamer::EwSkew::update), py::arg("value"), py::arg("out") = py::none())
         .def("reset", &screamer::EwSkew::reset, "Reset to the initial state.");
 
 
-     py::class_<screamer::EwKurt>(m, "EwKurt")
+     py::class_<screamer::EwKurt, screamer::ScreamerBase>(m, "EwKurt")
         .def(
           py::init<
                std::optional<double>,
@@ -110,24 +124,111 @@ void init_bindings_ew(py::module& m) {
           py::arg("halflife") = std::nullopt,
           py::arg("alpha") = std::nullopt
         )
-        .def("__call__", &screamer::EwKurt::operator(), py::arg("value"))
+        .def("__call__", &screamer::EwKurt::operator(), py::arg("value"), py::arg("n_threads") = 1, py::arg("out") = py::none())
+        .def("update", py::overload_cast<double>(&screamer::EwKurt::update), py::arg("value"))
+        .def("update", py::overload_cast<py::object, py::object>(&screamer::EwKurt::update), py::arg("value"), py::arg("out") = py::none())
         .def("reset", &screamer::EwKurt::reset, "Reset to the initial state.");
 
 
-     py::class_<screamer::EwRms>(m, "EwRms")
+     py::class_<screamer::EwMoments, screamer::ScreamerBase>(m, "EwMoments")
         .def(
           py::init<
+               const std::vector<std::string>&,
                std::optional<double>,
                std::optional<double>,
                std::optional<double>,
                std::optional<double>
           >(),
+          py::arg("outputs") = std::vector<std::string>{"mean", "std", "skew", "kurt"},
           py::arg("com") = std::nullopt,
           py::arg("span") = std::nullopt,
           py::arg("halflife") = std::nullopt,
           py::arg("alpha") = std::nullopt
         )
-        .def("__call__", &screamer::EwRms::operator(), py::arg("value"))
+        .def("__call__", &screamer::EwMoments::operator(), py::arg("value"), py::arg("n_threads") = 1, py::arg("out") = py::none())
+        .def("update", py::overload_cast<double>(&screamer::EwMoments::update), py::arg("value"))
+        .def("update", py::overload_cast<py::object, py::object>(&screamer::EwMoments::update), py::arg("value"), py::arg("out") = py::none())
+        .def("reset", &screamer::EwMoments::reset, "Reset to the initial state.");
+
+
+     py::class_<screamer::EwCov, screamer::ScreamerBase2>(m, "EwCov")
+        .def(
+          py::init<
+               std::optional<double>,
+               std::optional<double>,
+               std::optional<double>,
+               std::optional<double>
+          >(),
+          py::arg("com") = std::nullopt,
+          py::arg("span") = std::nullopt,
+          py::arg("halflife") = std::nullopt,
+          py::arg("alpha") = std::nullopt
+        )
+        .def("__call__", &screamer::EwCov::operator(), py::arg("x"), py::arg("y"), py::arg("n_threads") = 1, py::arg("out") = py::none())
+        .def("update", py::overload_cast<double, double>(&screamer::EwCov::update), py::arg("x"), py::arg("y"))
+        .def("update", py::overload_cast<py::object, py::object, py::object>(&screamer::EwCov::update), py::arg("x"), py::arg("y"), py::arg("out") = py::none())
+        .def("reset", &screamer::EwCov::reset, "Reset to the initial state.");
+
+
+     py::class_<screamer::EwCorr, screamer::ScreamerBase2>(m, "EwCorr")
+        .def(
+          py::init<
+               std::optional<double>,
+               std::optional<double>,
+               std::optional<double>,
+               std::optional<double>
+          >(),
+          py::arg("com") = std::nullopt,
+          py::arg("span") = std::nullopt,
+          py::arg("halflife") = std::nullopt,
+          py::arg("alpha") = std::nullopt
+        )
+        .def("__call__", &screamer::EwCorr::operator(), py::arg("x"), py::arg("y"), py::arg("n_threads") = 1, py::arg("out") = py::none())
+        .def("update", py::overload_cast<double, double>(&screamer::EwCorr::update), py::arg("x"), py::arg("y"))
+        .def("update", py::overload_cast<py::object, py::object, py::object>(&screamer::EwCorr::update), py::arg("x"), py::arg("y"), py::arg("out") = py::none())
+        .def("reset", &screamer::EwCorr::reset, "Reset to the initial state.");
+
+
+     py::class_<screamer::EwRLS, screamer::ScreamerRegression>(m, "EwRLS")
+        .def(
+          py::init<
+               int,
+               std::optional<double>,
+               std::optional<double>,
+               std::optional<double>,
+               std::optional<double>,
+               const std::string&,
+               bool
+          >(),
+          py::arg("k"),
+          py::arg("com") = std::nullopt,
+          py::arg("span") = std::nullopt,
+          py::arg("halflife") = std::nullopt,
+          py::arg("alpha") = std::nullopt,
+          py::arg("output") = "coef",
+          py::arg("fit_intercept") = true
+        )
+        .def("__call__", &screamer::EwRLS::operator(), py::arg("x"), py::arg("y"))
+        .def("update", &screamer::EwRLS::update, py::arg("x"), py::arg("y"))
+        .def("reset", &screamer::EwRLS::reset, "Reset to the initial state.");
+
+
+     py::class_<screamer::EwRms, screamer::ScreamerBase>(m, "EwRms")
+        .def(
+          py::init<
+               std::optional<double>,
+               std::optional<double>,
+               std::optional<double>,
+               std::optional<double>
+          >(),
+          py::arg("com") = std::nullopt,
+          py::arg("span") = std::nullopt,
+          py::arg("halflife") = std::nullopt,
+          py::arg("alpha") = std::nullopt
+        )
+        .def("__call__", &screamer::EwRms::operator(), py::arg("value"), py::arg("n_threads") = 1, py::arg("out") = py::none())
+        .def("update", py::overload_cast<double>(&screamer::EwRms::update), py::arg("value"))
+        .def("update", py::overload_cast<py::object, py::object>(&screamer::EwRms::update), py::arg("value"), py::arg("out") = py::none())
         .def("reset", &screamer::EwRms::reset, "Reset to the initial state.");
 
 }
@@ -11,16 +11,22 @@ void init_bindings_fin(py::module& m) {
 
     py::class_<screamer::Return, screamer::ScreamerBase>(m, "Return")
         .def(py::init<int>(), py::arg("window_size"))
-        .def("__call__", &screamer::Return::operator(), py::arg("value"))
+        .def("__call__", &screamer::Return::operator(), py::arg("value"), py::arg("n_threads") = 1, py::arg("out") = py::none())
+        .def("update", py::overload_cast<double>(&screamer::Return::update), py::arg("value"))
+        .def("update", py::overload_cast<py::object, py::object>(&screamer::Return::update), py::arg("value"), py::arg("out") = py::none())
         .def("reset", &screamer::Return::reset, "Reset to the initial state.");
 
     py::class_<screamer::LogReturn, screamer::ScreamerBase>(m, "LogReturn")
         .def(py::init<int>(), py::arg("window_size"))
-        .def("__call__", &screamer::LogReturn::operator(), py::arg("value"))
+        .def("__call__", &screamer::LogReturn::operator(), py::arg("value"), py::arg("n_threads") = 1, py::arg("out") = py::none())
+        .def("update", py::overload_cast<double>(&screamer::LogReturn::update), py::arg("value"))
+        .def("update", py::overload_cast<py::object, py::object>(&screamer::LogReturn::update), py::arg("value"), py::arg("out") = py::none())
         .def("reset", &screamer::LogReturn::reset, "Reset to the initial state.");
     
     py::class_<screamer::RollingFracDiff, screamer::ScreamerBase>(m, "RollingFracDiff")
         .def(py::init<double, int, double>(), py::arg("frac_order"), py::arg("window_size"), py::arg("threshold")=1e-5)
-        .def("__call__", &screamer::RollingFracDiff::operator(), py::arg("value"))
+        .def("__call__", &screamer::RollingFracDiff::operator(), py::arg("value"), py::arg("n_threads") = 1, py::arg("out") = py::none())
+        .def("update", py::overload_cast<double>(&screamer::RollingFracDiff::update), py::arg("value"))
+        .def("update", py::overload_cast<py::object, py::object>(&screamer::RollingFracDiff::update), py::arg("value"), py::arg("out") = py::none())
         .def("reset", &screamer::RollingFracDiff::reset, "Reset to the initial state.");
 }
\ No newline at end of file
@@ -3,6 +3,7 @@
 #include "screamer/common/base.h"
 #include "screamer/lag.h"
 #include "screamer/diff.h"
+#include "screamer/pipeline.h"
 
 namespace py = pybind11;
 
@@ -10,12 +11,24 @@ void init_bindings_misc(py::module& m) {
 
     py::class_<screamer::Diff, screamer::ScreamerBase>(m, "Diff")
         .def(py::init<int, const std::string&>(), py::arg("window_size"), py::arg("start_policy") = "strict")
-        .def("__call__", &screamer::Diff::operator(), py::arg("value"))
+        .def("__call__", &screamer::Diff::operator(), py::arg("value"), py::arg("n_threads") = 1, py::arg("out") = py::none())
+        .def("update", py::overload_cast<double>(&screamer::Diff::update), py::arg("value"))
+        .def("update", py::overload_cast<py::object, py::object>(&screamer::Diff::update), py::arg("value"), py::arg("out") = py::none())
         .def("reset", &screamer::Diff::reset, "Reset to the initial state.");
 
     py::class_<screamer::Lag, screamer::ScreamerBase>(m, "Lag")
         .def(py::init<int, const std::string&>(), py::arg("window_size"), py::arg("start_policy") = "strict")
-        .def("__call__", &screamer::Lag::operator(), py::arg("value"))
+        .def("__call__", &screamer::Lag::operator(), py::arg("value"), py::arg("n_threads") = 1, py::arg("out") = py::none())
+        .def("update", py::overload_cast<double>(&screamer::Lag::update), py::arg("value"))
+        .def("update", py::overload_cast<py::object, py::object>(&screamer::Lag::update), py::arg("value"), py::arg("out") = py::none())
         .def("reset", &screamer::Lag::reset, "Reset to the initial state.");
 
+    py::class_<screamer::Pipeline, screamer::ScreamerBase>(m, "Pipeline")
+        .def(py::init<const std::vector<screamer::ScreamerBase*>&>(), py::arg("stages"))
+        .def("__call__", &screamer::Pipeline::operator(), py::arg("value"), py::arg("n_threads") = 1, py::arg("out") = py::none())
+        .def("update", py::overload_cast<double>(&screamer::Pipeline::update), py::arg("value"))
+        .def("update", py::overload_cast<py::object, py::object>(&screamer::Pipeline::update), py::arg("value"), py::arg("out") = py::none())
+        .def("__len__", &screamer::Pipeline::size)
+        .def("reset", &screamer::Pipeline::reset, "Reset to the initial state.");
+
 }
\ No newline at end of file
@@ -11,16 +11,20 @@ void init_bindings_preprocessing(py::module& m) {
 
     py::class_<screamer::Ffill, screamer::ScreamerBase>(m, "Ffill")
         .def(py::init<>())
-        .def("__call__", &screamer::Ffill::operator(), py::arg("value"))
+        .def("__call__", &screamer::Ffill::operator(), py::arg("value"), py::arg("n_threads") = 1, py::arg("out") = py::none())
+        .def("update", py::overload_cast<double>(&screamer::Ffill::update), py::arg("value"))
+        .def("update", py::overload_cast<py::object, py::object>(&screamer::Ffill::update), py::arg("value"), py::arg("out") = py::none())
         .def("reset", &screamer::Ffill::reset, "Reset to the initial state.");
 
     py::class_<screamer::FillNa, screamer::ScreamerBase>(m, "FillNa")
         .def(py::init<double>(), py::arg("fill"))
-        .def("__call__", &screamer::FillNa::operator(), py::arg("value"))
+        .def("__call__", &screamer::FillNa::operator(), py::arg("value"), py::arg("n_threads") = 1, py::arg("out") = py::none())
+        .def("update", py::overload_cast<double>(&screamer::FillNa::update), py::arg("value"))
+        .def("update", py::overload_cast<py::object, py::object>(&screamer::FillNa::update), py::arg("value"), py::arg("out") = py::none())
         .def("reset", &screamer::FillNa::reset, "Reset to the initial state.");
 
 
-     py::class_<screamer::Clip>(m, "Clip")
+     py::class_<screamer::Clip, screamer::ScreamerBase>(m, "Clip")
         .def(
           py::init<
                std::optional<double>,
@@ -29,7 +33,9 @@ void init_bindings_preprocessing(py::module& m) {
           py::arg("lower") = std::nullopt,
           py::arg("upper") = std::nullopt
         )
-        .def("__call__", &screamer::Clip::operator(), py::arg("value"))
+        .def("__call__", &screamer::Clip::operator(), py::arg("value"), py::arg("n_threads") = 1, py::arg("out") = py::none())
+        .def("update", py::overload_cast<double>(&screamer::Clip::update), py::arg("value"))
+        .def("update", py::overload_cast<py::object, py::object>(&screamer::Clip::update), py::arg("value"), py::arg("out") = py::none())
         .def("reset", &screamer::Clip::reset, "Reset to the initial state.");
 
 }
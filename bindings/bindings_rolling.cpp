@@ -8,13 +8,30 @@
 #include "screamer/rolling_skew.h"
 #include "screamer/rolling_kurt.h"
 #include "screamer/rolling_zscore.h"
+#include "screamer/rolling_moments.h"
+#include "screamer/rolling_cov.h"
+#include "screamer/rolling_corr.h"
+#include "screamer/rolling_beta.h"
 #include "screamer/rolling_min.h"
 #include "screamer/rolling_max.h"
+#include "screamer/rolling_min_max.h"
+#include "screamer/rolling_max_abs.h"
+#include "screamer/rolling_arg_max.h"
+#include "screamer/rolling_arg_min.h"
+#include "screamer/rolling_prod.h"
+#include "screamer/rolling_any.h"
+#include "screamer/rolling_all.h"
 #include "screamer/rolling_median.h"
 #include "screamer/rolling_quantile.h"
+#include "screamer/rolling_approx_quantile.h"
+#include "screamer/p2_quantile.h"
+#include "screamer/rolling_rank.h"
+#include "screamer/rolling_mad.h"
+#include "screamer/rolling_hampel.h"
 #include "screamer/rolling_rms.h"
 #include "screamer/rolling_poly1.h"
 #include "screamer/rolling_poly2.h"
+#include "screamer/rolling_ols.h"
 #include "screamer/rolling_sigma_clip.h"
 #include "screamer/rolling_ou.h"
 #include "screamer/rolling_rsi.h"
@@ -27,120 +44,297 @@ void init_bindings_rolling(py::module& m) {
         .def(py::init<int, const std::string&>(), 
             py::arg("window_size"), 
             py::arg("start_policy") = "strict")
-        .def("__call__", &screamer::RollingMean::operator(), py::arg("value"))
+        .def("__call__", &screamer::RollingMean::operator(), py::arg("value"), py::arg("n_threads") = 1, py::arg("out") = py::none())
+        .def("update", py::overload_cast<double>(&screamer::RollingMean::update), py::arg("value"))
+        .def("update", py::overload_cast<py::object, py::object>(&screamer::RollingMean::update), py::arg("value"), py::arg("out") = py::none())
         .def("reset", &screamer::RollingMean::reset, "Reset to the initial state.");
 
     py::class_<screamer::RollingRms, screamer::ScreamerBase>(m, "RollingRms")
         .def(py::init<int, const std::string&>(),
             py::arg("window_size"),
             py::arg("start_policy") = "strict")
-        .def("__call__", &screamer::RollingRms::operator(), py::arg("value"))
+        .def("__call__", &screamer::RollingRms::operator(), py::arg("value"), py::arg("n_threads") = 1, py::arg("out") = py::none())
+        .def("update", py::overload_cast<double>(&screamer::RollingRms::update), py::arg("value"))
+        .def("update", py::overload_cast<py::object, py::object>(&screamer::RollingRms::update), py::arg("value"), py::arg("out") = py::none())
         .def("reset", &screamer::RollingRms::reset, "Reset to the initial state.");
 
     py::class_<screamer::RollingSum, screamer::ScreamerBase>(m, "RollingSum")
         .def(py::init<int, const std::string&>(), 
             py::arg("window_size"), 
             py::arg("start_policy") = "strict")
-        .def("__call__", &screamer::RollingSum::operator(), py::arg("value"))
+        .def("__call__", &screamer::RollingSum::operator(), py::arg("value"), py::arg("n_threads") = 1, py::arg("out") = py::none())
+        .def("update", py::overload_cast<double>(&screamer::RollingSum::update), py::arg("value"))
+        .def("update", py::overload_cast<py::object, py::object>(&screamer::RollingSum::update), py::arg("value"), py::arg("out") = py::none())
         .def("reset", &screamer::RollingSum::reset, "Reset to the initial state.");
 
     py::class_<screamer::RollingStd, screamer::ScreamerBase>(m, "RollingStd")
         .def(py::init<int, const std::string&>(),
             py::arg("window_size"),
             py::arg("start_policy") = "strict")
-        .def("__call__", &screamer::RollingStd::operator(), py::arg("value"))
+        .def("__call__", &screamer::RollingStd::operator(), py::arg("value"), py::arg("n_threads") = 1, py::arg("out") = py::none())
+        .def("update", py::overload_cast<double>(&screamer::RollingStd::update), py::arg("value"))
+        .def("update", py::overload_cast<py::object, py::object>(&screamer::RollingStd::update), py::arg("value"), py::arg("out") = py::none())
         .def("reset", &screamer::RollingStd::reset, "Reset to the initial state.");
 
     py::class_<screamer::RollingVar, screamer::ScreamerBase>(m, "RollingVar")
         .def(py::init<int, const std::string&>(),
             py::arg("window_size"),
             py::arg("start_policy") = "strict")
-        .def("__call__", &screamer::RollingVar::operator(), py::arg("value"))
+        .def("__call__", &screamer::RollingVar::operator(), py::arg("value"), py::arg("n_threads") = 1, py::arg("out") = py::none())
+        .def("update", py::overload_cast<double>(&screamer::RollingVar::update), py::arg("value"))
+        .def("update", py::overload_cast<py::object, py::object>(&screamer::RollingVar::update), py::arg("value"), py::arg("out") = py::none())
         .def("reset", &screamer::RollingVar::reset, "Reset to the initial state.");
 
     py::class_<screamer::RollingSkew, screamer::ScreamerBase>(m, "RollingSkew")
         .def(py::init<int, const std::string&>(),
             py::arg("window_size"),
             py::arg("start_policy") = "strict")
-        .def("__call__", &screamer::RollingSkew::operator(), py::arg("value"))
+        .def("__call__", &screamer::RollingSkew::operator(), py::arg("value"), py::arg("n_threads") = 1, py::arg("out") = py::none())
+        .def("update", py::overload_cast<double>(&screamer::RollingSkew::update), py::arg("value"))
+        .def("update", py::overload_cast<py::object, py::object>(&screamer::RollingSkew::update), py::arg("value"), py::arg("out") = py::none())
         .def("reset", &screamer::RollingSkew::reset, "Reset to the initial state.");
 
     py::class_<screamer::RollingKurt, screamer::ScreamerBase>(m, "RollingKurt")
         .def(py::init<int, const std::string&>(),
             py::arg("window_size"),
             py::arg("start_policy") = "strict")
-        .def("__call__", &screamer::RollingKurt::operator(), py::arg("value"))
+        .def("__call__", &screamer::RollingKurt::operator(), py::arg("value"), py::arg("n_threads") = 1, py::arg("out") = py::none())
+        .def("update", py::overload_cast<double>(&screamer::RollingKurt::update), py::arg("value"))
+        .def("update", py::overload_cast<py::object, py::object>(&screamer::RollingKurt::update), py::arg("value"), py::arg("out") = py::none())
         .def("reset", &screamer::RollingKurt::reset, "Reset to the initial state.");
 
+    py::class_<screamer::RollingMoments, screamer::ScreamerBase>(m, "RollingMoments")
+        .def(py::init<int, const std::vector<std::string>&, const std::string&>(),
+            py::arg("window_size"),
+            py::arg("outputs") = std::vector<std::string>{"mean", "std", "skew", "kurt"},
+            py::arg("start_policy") = "strict")
+        .def("__call__", &screamer::RollingMoments::operator(), py::arg("value"), py::arg("n_threads") = 1, py::arg("out") = py::none())
+        .def("update", py::overload_cast<double>(&screamer::RollingMoments::update), py::arg("value"))
+        .def("update", py::overload_cast<py::object, py::object>(&screamer::RollingMoments::update), py::arg("value"), py::arg("out") = py::none())
+        .def("reset", &screamer::RollingMoments::reset, "Reset to the initial state.");
+
+    py::class_<screamer::RollingCov, screamer::ScreamerBase2>(m, "RollingCov")
+        .def(py::init<int, const std::string&>(),
+            py::arg("window_size"),
+            py::arg("start_policy") = "strict")
+        .def("__call__", &screamer::RollingCov::operator(), py::arg("x"), py::arg("y"), py::arg("n_threads") = 1, py::arg("out") = py::none())
+        .def("update", py::overload_cast<double, double>(&screamer::RollingCov::update), py::arg("x"), py::arg("y"))
+        .def("update", py::overload_cast<py::object, py::object, py::object>(&screamer::RollingCov::update), py::arg("x"), py::arg("y"), py::arg("out") = py::none())
+        .def("reset", &screamer::RollingCov::reset, "Reset to the initial state.");
+
+    py::class_<screamer::RollingCorr, screamer::ScreamerBase2>(m, "RollingCorr")
+        .def(py::init<int, const std::string&>(),
+            py::arg("window_size"),
+            py::arg("start_policy") = "strict")
+        .def("__call__", &screamer::RollingCorr::operator(), py::arg("x"), py::arg("y"), py::arg("n_threads") = 1, py::arg("out") = py::none())
+        .def("update", py::overload_cast<double, double>(&screamer::RollingCorr::update), py::arg("x"), py::arg("y"))
+        .def("update", py::overload_cast<py::object, py::object, py::object>(&screamer::RollingCorr::update), py::arg("x"), py::arg("y"), py::arg("out") = py::none())
+        .def("reset", &screamer::RollingCorr::reset, "Reset to the initial state.");
+
+    py::class_<screamer::RollingBeta, screamer::ScreamerBase2>(m, "RollingBeta")
+        .def(py::init<int, const std::string&>(),
+            py::arg("window_size"),
+            py::arg("start_policy") = "strict")
+        .def("__call__", &screamer::RollingBeta::operator(), py::arg("x"), py::arg("y"), py::arg("n_threads") = 1, py::arg("out") = py::none())
+        .def("update", py::overload_cast<double, double>(&screamer::RollingBeta::update), py::arg("x"), py::arg("y"))
+        .def("update", py::overload_cast<py::object, py::object, py::object>(&screamer::RollingBeta::update), py::arg("x"), py::arg("y"), py::arg("out") = py::none())
+        .def("reset", &screamer::RollingBeta::reset, "Reset to the initial state.");
+
     py::class_<screamer::RollingMin, screamer::ScreamerBase>(m, "RollingMin")
         .def(py::init<int>(), py::arg("window_size"))
-        .def("__call__", &screamer::RollingMin::operator(), py::arg("value"))
+        .def("__call__", &screamer::RollingMin::operator(), py::arg("value"), py::arg("n_threads") = 1, py::arg("out") = py::none())
+        .def("update", py::overload_cast<double>(&screamer::RollingMin::update), py::arg("value"))
+        .def("update", py::overload_cast<py::object, py::object>(&screamer::RollingMin::update), py::arg("value"), py::arg("out") = py::none())
         .def("reset", &screamer::RollingMin::reset, "Reset to the initial state.");
 
     py::class_<screamer::RollingMax, screamer::ScreamerBase>(m, "RollingMax")
         .def(py::init<int>(), py::arg("window_size"))
-        .def("__call__", &screamer::RollingMax::operator(), py::arg("value"))
+        .def("__call__", &screamer::RollingMax::operator(), py::arg("value"), py::arg("n_threads") = 1, py::arg("out") = py::none())
+        .def("update", py::overload_cast<double>(&screamer::RollingMax::update), py::arg("value"))
+        .def("update", py::overload_cast<py::object, py::object>(&screamer::RollingMax::update), py::arg("value"), py::arg("out") = py::none())
         .def("reset", &screamer::RollingMax::reset, "Reset to the initial state.");
 
+    py::class_<screamer::RollingMinMax, screamer::ScreamerBase>(m, "RollingMinMax")
+        .def(py::init<int>(), py::arg("window_size"))
+        .def("__call__", &screamer::RollingMinMax::operator(), py::arg("value"), py::arg("n_threads") = 1, py::arg("out") = py::none())
+        .def("update", py::overload_cast<double>(&screamer::RollingMinMax::update), py::arg("value"))
+        .def("update", py::overload_cast<py::object, py::object>(&screamer::RollingMinMax::update), py::arg("value"), py::arg("out") = py::none())
+        .def("reset", &screamer::RollingMinMax::reset, "Reset to the initial state.");
+
+    py::class_<screamer::RollingRange, screamer::ScreamerBase>(m, "RollingRange")
+        .def(py::init<int>(), py::arg("window_size"))
+        .def("__call__", &screamer::RollingRange::operator(), py::arg("value"), py::arg("n_threads") = 1, py::arg("out") = py::none())
+        .def("update", py::overload_cast<double>(&screamer::RollingRange::update), py::arg("value"))
+        .def("update", py::overload_cast<py::object, py::object>(&screamer::RollingRange::update), py::arg("value"), py::arg("out") = py::none())
+        .def("reset", &screamer::RollingRange::reset, "Reset to the initial state.");
+
+    py::class_<screamer::RollingArgMax, screamer::ScreamerBase>(m, "RollingArgMax")
+        .def(py::init<int, bool>(), py::arg("window_size"), py::arg("with_value") = false)
+        .def("__call__", &screamer::RollingArgMax::operator(), py::arg("value"), py::arg("n_threads") = 1, py::arg("out") = py::none())
+        .def("update", py::overload_cast<double>(&screamer::RollingArgMax::update), py::arg("value"))
+        .def("update", py::overload_cast<py::object, py::object>(&screamer::RollingArgMax::update), py::arg("value"), py::arg("out") = py::none())
+        .def("reset", &screamer::RollingArgMax::reset, "Reset to the initial state.");
+
+    py::class_<screamer::RollingArgMin, screamer::ScreamerBase>(m, "RollingArgMin")
+        .def(py::init<int, bool>(), py::arg("window_size"), py::arg("with_value") = false)
+        .def("__call__", &screamer::RollingArgMin::operator(), py::arg("value"), py::arg("n_threads") = 1, py::arg("out") = py::none())
+        .def("update", py::overload_cast<double>(&screamer::RollingArgMin::update), py::arg("value"))
+        .def("update", py::overload_cast<py::object, py::object>(&screamer::RollingArgMin::update), py::arg("value"), py::arg("out") = py::none())
+        .def("reset", &screamer::RollingArgMin::reset, "Reset to the initial state.");
+
+    py::class_<screamer::RollingMaxAbs, screamer::ScreamerBase>(m, "RollingMaxAbs")
+        .def(py::init<int>(), py::arg("window_size"))
+        .def("__call__", &screamer::RollingMaxAbs::operator(), py::arg("value"), py::arg("n_threads") = 1, py::arg("out") = py::none())
+        .def("update", py::overload_cast<double>(&screamer::RollingMaxAbs::update), py::arg("value"))
+        .def("update", py::overload_cast<py::object, py::object>(&screamer::RollingMaxAbs::update), py::arg("value"), py::arg("out") = py::none())
+        .def("reset", &screamer::RollingMaxAbs::reset, "Reset to the initial state.");
+
+    py::class_<screamer::RollingProd, screamer::ScreamerBase>(m, "RollingProd")
+        .def(py::init<int>(), py::arg("window_size"))
+        .def("__call__", &screamer::RollingProd::operator(), py::arg("value"), py::arg("n_threads") = 1, py::arg("out") = py::none())
+        .def("update", py::overload_cast<double>(&screamer::RollingProd::update), py::arg("value"))
+        .def("update", py::overload_cast<py::object, py::object>(&screamer::RollingProd::update), py::arg("value"), py::arg("out") = py::none())
+        .def("reset", &screamer::RollingProd::reset, "Reset to the initial state.");
+
+    py::class_<screamer::RollingAny, screamer::ScreamerBase>(m, "RollingAny")
+        .def(py::init<int>(), py::arg("window_size"))
+        .def("__call__", &screamer::RollingAny::operator(), py::arg("value"), py::arg("n_threads") = 1, py::arg("out") = py::none())
+        .def("update", py::overload_cast<double>(&screamer::RollingAny::update), py::arg("value"))
+        .def("update", py::overload_cast<py::object, py::object>(&screamer::RollingAny::update), py::arg("value"), py::arg("out") = py::none())
+        .def("reset", &screamer::RollingAny::reset, "Reset to the initial state.");
+
+    py::class_<screamer::RollingAll, screamer::ScreamerBase>(m, "RollingAll")
+        .def(py::init<int>(), py::arg("window_size"))
+        .def("__call__", &screamer::RollingAll::operator(), py::arg("value"), py::arg("n_threads") = 1, py::arg("out") = py::none())
+        .def("update", py::overload_cast<double>(&screamer::RollingAll::update), py::arg("value"))
+        .def("update", py::overload_cast<py::object, py::object>(&screamer::RollingAll::update), py::arg("value"), py::arg("out") = py::none())
+        .def("reset", &screamer::RollingAll::reset, "Reset to the initial state.");
+
     py::class_<screamer::RollingMedian, screamer::ScreamerBase>(m, "RollingMedian")
         .def(py::init<int>(), py::arg("window_size"))
-        .def("__call__", &screamer::RollingMedian::operator(), py::arg("value"))
+        .def("__call__", &screamer::RollingMedian::operator(), py::arg("value"), py::arg("n_threads") = 1, py::arg("out") = py::none())
+        .def("update", py::overload_cast<double>(&screamer::RollingMedian::update), py::arg("value"))
+        .def("update", py::overload_cast<py::object, py::object>(&screamer::RollingMedian::update), py::arg("value"), py::arg("out") = py::none())
         .def("reset", &screamer::RollingMedian::reset, "Reset to the initial state.");
 
     py::class_<screamer::RollingQuantile, screamer::ScreamerBase>(m, "RollingQuantile")
         .def(py::init<int, double>(), py::arg("window_size"), py::arg("quantile"))
-        .def("__call__", &screamer::RollingQuantile::operator(), py::arg("value"))
+        .def(py::init<int, const std::vector<double>&>(), py::arg("window_size"), py::arg("quantiles"))
+        .def("__call__", &screamer::RollingQuantile::operator(), py::arg("value"), py::arg("n_threads") = 1, py::arg("out") = py::none())
+        .def("update", py::overload_cast<double>(&screamer::RollingQuantile::update), py::arg("value"))
+        .def("update", py::overload_cast<py::object, py::object>(&screamer::RollingQuantile::update), py::arg("value"), py::arg("out") = py::none())
         .def("reset", &screamer::RollingQuantile::reset, "Reset to the initial state.");
 
+    py::class_<screamer::RollingApproxQuantile, screamer::ScreamerBase>(m, "RollingApproxQuantile")
+        .def(py::init<int, double, double>(), py::arg("window_size"), py::arg("quantile"), py::arg("rank_error") = 0.01)
+        .def("__call__", &screamer::RollingApproxQuantile::operator(), py::arg("value"), py::arg("n_threads") = 1, py::arg("out") = py::none())
+        .def("update", py::overload_cast<double>(&screamer::RollingApproxQuantile::update), py::arg("value"))
+        .def("update", py::overload_cast<py::object, py::object>(&screamer::RollingApproxQuantile::update), py::arg("value"), py::arg("out") = py::none())
+        .def("reset", &screamer::RollingApproxQuantile::reset, "Reset to the initial state.");
+
+    py::class_<screamer::P2Quantile, screamer::ScreamerBase>(m, "P2Quantile")
+        .def(py::init<double>(), py::arg("quantile"))
+        .def("__call__", &screamer::P2Quantile::operator(), py::arg("value"), py::arg("n_threads") = 1, py::arg("out") = py::none())
+        .def("update", py::overload_cast<double>(&screamer::P2Quantile::update), py::arg("value"))
+        .def("update", py::overload_cast<py::object, py::object>(&screamer::P2Quantile::update), py::arg("value"), py::arg("out") = py::none())
+        .def("reset", &screamer::P2Quantile::reset, "Reset to the initial state.");
+
+    py::class_<screamer::RollingRank, screamer::ScreamerBase>(m, "RollingRank")
+        .def(py::init<int, bool>(), py::arg("window_size"), py::arg("normalize") = true)
+        .def("__call__", &screamer::RollingRank::operator(), py::arg("value"), py::arg("n_threads") = 1, py::arg("out") = py::none())
+        .def("update", py::overload_cast<double>(&screamer::RollingRank::update), py::arg("value"))
+        .def("update", py::overload_cast<py::object, py::object>(&screamer::RollingRank::update), py::arg("value"), py::arg("out") = py::none())
+        .def("reset", &screamer::RollingRank::reset, "Reset to the initial state.");
+
+    py::class_<screamer::RollingMAD, screamer::ScreamerBase>(m, "RollingMAD")
+        .def(py::init<int>(), py::arg("window_size"))
+        .def("__call__", &screamer::RollingMAD::operator(), py::arg("value"), py::arg("n_threads") = 1, py::arg("out") = py::none())
+        .def("update", py::overload_cast<double>(&screamer::RollingMAD::update), py::arg("value"))
+        .def("update", py::overload_cast<py::object, py::object>(&screamer::RollingMAD::update), py::arg("value"), py::arg("out") = py::none())
+        .def("reset", &screamer::RollingMAD::reset, "Reset to the initial state.");
+
+    py::class_<screamer::RollingHampel, screamer::ScreamerBase>(m, "RollingHampel")
+        .def(py::init<int, double, const std::string&>(),
+            py::arg("window_size"),
+            py::arg("n_sigmas") = 3.0,
+            py::arg("output") = "filtered")
+        .def("__call__", &screamer::RollingHampel::operator(), py::arg("value"), py::arg("n_threads") = 1, py::arg("out") = py::none())
+        .def("update", py::overload_cast<double>(&screamer::RollingHampel::update), py::arg("value"))
+        .def("update", py::overload_cast<py::object, py::object>(&screamer::RollingHampel::update), py::arg("value"), py::arg("out") = py::none())
+        .def("reset", &screamer::RollingHampel::reset, "Reset to the initial state.");
+
     py::class_<screamer::RollingZscore, screamer::ScreamerBase>(m, "RollingZscore")
         .def(py::init<int, const std::string&>(),
             py::arg("window_size"),
             py::arg("start_policy") = "strict")
-        .def("__call__", &screamer::RollingZscore::operator(), py::arg("value"))
+        .def("__call__", &screamer::RollingZscore::operator(), py::arg("value"), py::arg("n_threads") = 1, py::arg("out") = py::none())
+        .def("update", py::overload_cast<double>(&screamer::RollingZscore::update), py::arg("value"))
+        .def("update", py::overload_cast<py::object, py::object>(&screamer::RollingZscore::update), py::arg("value"), py::arg("out") = py::none())
         .def("reset", &screamer::RollingZscore::reset, "Reset to the initial state.");
 
-    py::class_<screamer::RollingPoly1>(m, "RollingPoly1")
+    py::class_<screamer::RollingPoly1, screamer::ScreamerBase>(m, "RollingPoly1")
         .def(py::init<int, int, const std::string&>(),
             py::arg("window_size"),
             py::arg("derivative_order") = 0,
             py::arg("start_policy") = "strict")
-        .def("__call__", &screamer::RollingPoly1::operator(), py::arg("value"))
+        .def("__call__", &screamer::RollingPoly1::operator(), py::arg("value"), py::arg("n_threads") = 1, py::arg("out") = py::none())
+        .def("update", py::overload_cast<double>(&screamer::RollingPoly1::update), py::arg("value"))
+        .def("update", py::overload_cast<py::object, py::object>(&screamer::RollingPoly1::update), py::arg("value"), py::arg("out") = py::none())
         .def("reset", &screamer::RollingPoly1::reset, "Reset to the initial state.");
 
 
-    py::class_<screamer::RollingPoly2>(m, "RollingPoly2")
+    py::class_<screamer::RollingPoly2, screamer::ScreamerBase>(m, "RollingPoly2")
         .def(py::init<int, int, const std::string&>(),
             py::arg("window_size"),
             py::arg("derivative_order") = 0,
             py::arg("start_policy") = "strict")
-        .def("__call__", &screamer::RollingPoly2::operator(), py::arg("value"))
+        .def("__call__", &screamer::RollingPoly2::operator(), py::arg("value"), py::arg("n_threads") = 1, py::arg("out") = py::none())
+        .def("update", py::overload_cast<double>(&screamer::RollingPoly2::update), py::arg("value"))
+        .def("update", py::overload_cast<py::object, py::object>(&screamer::RollingPoly2::update), py::arg("value"), py::arg("out") = py::none())
         .def("reset", &screamer::RollingPoly2::reset, "Reset to the initial state.");
 
+    py::class_<screamer::RollingOLS, screamer::ScreamerRegression>(m, "RollingOLS")
+        .def(py::init<int, int, const std::string&, bool, const std::string&>(),
+            py::arg("window_size"),
+            py::arg("k"),
+            py::arg("output") = "coef",
+            py::arg("fit_intercept") = true,
+            py::arg("start_policy") = "strict")
+        .def("__call__", &screamer::RollingOLS::operator(), py::arg("x"), py::arg("y"))
+        .def("update", &screamer::RollingOLS::update, py::arg("x"), py::arg("y"))
+        .def("reset", &screamer::RollingOLS::reset, "Reset to the initial state.");
+
 
-     py::class_<screamer::RollingSigmaClip>(m, "RollingSigmaClip")
+     py::class_<screamer::RollingSigmaClip, screamer::ScreamerBase>(m, "RollingSigmaClip")
         .def(py::init<int, std::optional<double>, std::optional<double>, std::optional<int>>(),
             py::arg("window_size"),
             py::arg("lower") = std::nullopt,
             py::arg("upper") = std::nullopt,
             py::arg("output") = std::nullopt
         )
-        .def("__call__", &screamer::RollingSigmaClip::operator(), py::arg("value"))
+        .def("__call__", &screamer::RollingSigmaClip::operator(), py::arg("value"), py::arg("n_threads") = 1, py::arg("out") = py::none())
+        .def("update", py::overload_cast<double>(&screamer::RollingSigmaClip::update), py::arg("value"))
+        .def("update", py::overload_cast<py::object, py::object>(&screamer::RollingSigmaClip::update), py::arg("value"), py::arg("out") = py::none())
         .def("reset", &screamer::RollingSigmaClip::reset, "Reset to the initial state.");
 
 
-     py::class_<screamer::RollingOU>(m, "RollingOU")
+     py::class_<screamer::RollingOU, screamer::ScreamerBase>(m, "RollingOU")
         .def(py::init<int, std::optional<int>, const std::string&>(),
             py::arg("window_size"),
             py::arg("output") = std::nullopt,
             py::arg("start_policy") = "strict")
-        .def("__call__", &screamer::RollingOU::operator(), py::arg("value"))
+        .def("__call__", &screamer::RollingOU::operator(), py::arg("value"), py::arg("n_threads") = 1, py::arg("out") = py::none())
+        .def("update", py::overload_cast<double>(&screamer::RollingOU::update), py::arg("value"))
+        .def("update", py::overload_cast<py::object, py::object>(&screamer::RollingOU::update), py::arg("value"), py::arg("out") = py::none())
         .def("reset", &screamer::RollingOU::reset, "Reset to the initial state.");
 
     py::class_<screamer::RollingRSI, screamer::ScreamerBase>(m, "RollingRSI")
         .def(py::init<int, const std::string&>(),
             py::arg("window_size"),
             py::arg("start_policy") = "strict")
-        .def("__call__", &screamer::RollingRSI::operator(), py::arg("value"))
+        .def("__call__", &screamer::RollingRSI::operator(), py::arg("value"), py::arg("n_threads") = 1, py::arg("out") = py::none())
+        .def("update", py::overload_cast<double>(&screamer::RollingRSI::update), py::arg("value"))
+        .def("update", py::overload_cast<py::object, py::object>(&screamer::RollingRSI::update), py::arg("value"), py::arg("out") = py::none())
         .def("reset", &screamer::RollingRSI::reset, "Reset to the initial state.");
 
 
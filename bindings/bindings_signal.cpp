@@ -9,7 +9,9 @@ void init_bindings_signal(py::module& m) {
 
     py::class_<screamer::Butter, screamer::ScreamerBase>(m, "Butter")
         .def(py::init<int,double>(),  py::arg("order"), py::arg("cutoff_freq"))
-        .def("__call__", &screamer::Butter::operator(), py::arg("value"))
+        .def("__call__", &screamer::Butter::operator(), py::arg("value"), py::arg("n_threads") = 1, py::arg("out") = py::none())
+        .def("update", py::overload_cast<double>(&screamer::Butter::update), py::arg("value"))
+        .def("update", py::overload_cast<py::object, py::object>(&screamer::Butter::update), py::arg("value"), py::arg("out") = py::none())
         .def("reset", &screamer::Butter::reset, "Reset to the initial state.");
 
 }
\ No newline at end of file
@@ -0,0 +1,10 @@
+import pandas as pd
+import numpy as np
+
+class RollingAny_pandas:
+    def __init__(self, window_size):
+        self.window_size = window_size
+
+    def __call__(self, array):
+        nonzero = ((array != 0) & ~np.isnan(array)).astype(float)
+        return pd.Series(nonzero).rolling(window=self.window_size, min_periods=1).max().to_numpy()
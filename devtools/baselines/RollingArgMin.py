@@ -0,0 +1,23 @@
+import pandas as pd
+import numpy as np
+
+def _age_of_argmin(window):
+    # the newest of equal extremes counts
+    return np.argmin(window[::-1])
+
+class RollingArgMin_pandas:
+    def __init__(self, window_size):
+        self.window_size = window_size
+
+    def __call__(self, array):
+        rolling = pd.Series(array).rolling(window=self.window_size, min_periods=1)
+        return rolling.apply(_age_of_argmin, raw=True).to_numpy()
+
+class RollingArgMin_numpy:
+    def __init__(self, window_size):
+        self.window_size = window_size
+
+    def __call__(self, array):
+        windowed_array = np.lib.stride_tricks.sliding_window_view(array, self.window_size)
+        ans = np.argmin(windowed_array[:, ::-1], axis=-1)
+        return np.concatenate((np.full(self.window_size - 1, np.nan), ans))
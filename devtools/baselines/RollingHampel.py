@@ -0,0 +1,19 @@
+import numpy as np
+
+class RollingHampel_numpy:
+    def __init__(self, window_size, n_sigmas=3.0, output='filtered'):
+        self.window_size = window_size
+        self.n_sigmas = n_sigmas
+        self.output = output
+
+    def __call__(self, array):
+        windowed_array = np.lib.stride_tricks.sliding_window_view(array, self.window_size)
+        median = np.median(windowed_array, axis=-1)
+        mad = np.median(np.abs(windowed_array - median[:, None]), axis=-1)
+        x = array[self.window_size - 1:]
+        outlier = np.abs(x - median) > self.n_sigmas * (1.482602218505602 * mad)
+        if self.output == 'flag':
+            ans = outlier.astype(np.float64)
+        else:
+            ans = np.where(outlier, median, x)
+        return np.concatenate((np.full(self.window_size - 1, np.nan), ans))
@@ -0,0 +1,20 @@
+import pandas as pd
+import numpy as np
+
+class RollingMAD_pandas:
+    def __init__(self, window_size):
+        self.window_size = window_size
+
+    def __call__(self, array):
+        mad = lambda w: np.median(np.abs(w - np.median(w)))
+        return pd.Series(array).rolling(window=self.window_size).apply(mad, raw=True).to_numpy()
+
+class RollingMAD_numpy:
+    def __init__(self, window_size):
+        self.window_size = window_size
+
+    def __call__(self, array):
+        windowed_array = np.lib.stride_tricks.sliding_window_view(array, self.window_size)
+        median = np.median(windowed_array, axis=-1, keepdims=True)
+        ans = np.median(np.abs(windowed_array - median), axis=-1)
+        return np.concatenate((np.full(self.window_size - 1, np.nan), ans))
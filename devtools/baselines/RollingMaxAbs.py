@@ -0,0 +1,18 @@
+import pandas as pd
+import numpy as np
+
+class RollingMaxAbs_pandas:
+    def __init__(self, window_size):
+        self.window_size = window_size
+
+    def __call__(self, array):
+        return pd.Series(np.abs(array)).rolling(window=self.window_size, min_periods=1).max().to_numpy()
+
+class RollingMaxAbs_numpy:
+    def __init__(self, window_size):
+        self.window_size = window_size
+
+    def __call__(self, array):
+        windowed_array = np.lib.stride_tricks.sliding_window_view(np.abs(array), self.window_size)
+        ans = np.max(windowed_array, axis=-1)
+        return np.concatenate((np.maximum.accumulate(np.abs(array[:self.window_size - 1])), ans))
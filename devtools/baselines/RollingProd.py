@@ -0,0 +1,18 @@
+import pandas as pd
+import numpy as np
+
+class RollingProd_pandas:
+    def __init__(self, window_size):
+        self.window_size = window_size
+
+    def __call__(self, array):
+        return pd.Series(array).rolling(window=self.window_size, min_periods=1).apply(np.prod, raw=True).to_numpy()
+
+class RollingProd_numpy:
+    def __init__(self, window_size):
+        self.window_size = window_size
+
+    def __call__(self, array):
+        windowed_array = np.lib.stride_tricks.sliding_window_view(array, self.window_size)
+        ans = np.prod(windowed_array, axis=-1)
+        return np.concatenate((np.cumprod(array[:self.window_size - 1]), ans))
@@ -0,0 +1,19 @@
+import pandas as pd
+import numpy as np
+
+class RollingRange_pandas:
+    def __init__(self, window_size):
+        self.window_size = window_size
+
+    def __call__(self, array):
+        rolling = pd.Series(array).rolling(window=self.window_size)
+        return (rolling.max() - rolling.min()).to_numpy()
+
+class RollingRange_numpy:
+    def __init__(self, window_size):
+        self.window_size = window_size
+
+    def __call__(self, array):
+        windowed_array = np.lib.stride_tricks.sliding_window_view(array, self.window_size)
+        ans = np.ptp(windowed_array, axis=-1)
+        return np.concatenate((np.full(self.window_size - 1, np.nan), ans))
@@ -0,0 +1,23 @@
+import pandas as pd
+import numpy as np
+from scipy.stats import rankdata
+
+class RollingRank_pandas:
+    def __init__(self, window_size, normalize=True):
+        self.window_size = window_size
+        self.normalize = normalize
+
+    def __call__(self, array):
+        return pd.Series(array).rolling(window=self.window_size).rank(pct=self.normalize).to_numpy()
+
+class RollingRank_numpy:
+    def __init__(self, window_size, normalize=True):
+        self.window_size = window_size
+        self.normalize = normalize
+
+    def __call__(self, array):
+        windowed_array = np.lib.stride_tricks.sliding_window_view(array, self.window_size)
+        ans = rankdata(windowed_array, axis=-1)[:, -1]
+        if self.normalize:
+            ans = ans / self.window_size
+        return np.concatenate((np.full(self.window_size - 1, np.nan), ans))
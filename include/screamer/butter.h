@@ -10,7 +10,7 @@
 
 namespace screamer {
 
-    class Butter : public ScreamerBase {
+    class Butter : public ScreamerKernel<Butter> {
     public:
 
 
@@ -26,7 +26,7 @@ namespace screamer {
             irr.reset();
         }
 
-        double process_scalar(double newValue) override {
+        double step(double newValue) {
             return irr.process_scalar(newValue);
         }
 
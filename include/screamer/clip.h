@@ -8,18 +8,20 @@
 #include <algorithm>
 #include <execution>
 #include <cmath>
+#include <optional>
 
 namespace py = pybind11;
 
 namespace screamer {
 
-    class Clip : public ScreamerBase {
+    class Clip : public ScreamerKernel<Clip> {
     public:
         Clip(std::optional<double> lower = std::nullopt, std::optional<double> upper = std::nullopt)
             : lower_(lower), upper_(upper) {}
 
-    private:
-        double process_scalar(double newValue) override {
+        bool supports_inplace() const override { return true; }
+
+        double step(double newValue) {
             if (lower_.has_value() && newValue < lower_.value()) {
                 newValue = lower_.value();
             }
@@ -29,11 +31,12 @@ namespace screamer {
             return newValue;
         }
 
-        void process_array_no_stride(double* y, const double* x, size_t size) override {
+        template <typename T>
+        void array_no_stride(T* y, const T* x, size_t size) {
             size_t i = 0;
 
-            double lower_bound = lower_.value_or(std::numeric_limits<double>::lowest());
-            double upper_bound = upper_.value_or(std::numeric_limits<double>::max());
+            T lower_bound = lower_bound_as<T>();
+            T upper_bound = upper_bound_as<T>();
 
             // Process elements in chunks of 4 for optimization
             for (; i + 4 <= size; i += 4) {
@@ -49,12 +52,13 @@ namespace screamer {
             }
         }
 
-        void process_array_stride(double* y, size_t dyi, const double* x, size_t dxi, size_t size) override {
+        template <typename T>
+        void array_stride(T* y, size_t dyi, const T* x, size_t dxi, size_t size) {
             size_t yi = 0;
             size_t xi = 0;
 
-            double lower_bound = lower_.value_or(std::numeric_limits<double>::lowest());
-            double upper_bound = upper_.value_or(std::numeric_limits<double>::max());
+            T lower_bound = lower_bound_as<T>();
+            T upper_bound = upper_bound_as<T>();
 
             for (size_t i = 0; i < size; i++) {
                 y[yi] = std::clamp(x[xi], lower_bound, upper_bound);
@@ -64,6 +68,17 @@ namespace screamer {
         }
 
     private:
+        // Bounds in the value type of the array, missing bounds become the type's limits
+        template <typename T>
+        T lower_bound_as() const {
+            return lower_.has_value() ? static_cast<T>(lower_.value()) : std::numeric_limits<T>::lowest();
+        }
+
+        template <typename T>
+        T upper_bound_as() const {
+            return upper_.has_value() ? static_cast<T>(upper_.value()) : std::numeric_limits<T>::max();
+        }
+
         std::optional<double> lower_;
         std::optional<double> upper_;
     };
@@ -0,0 +1,75 @@
+#ifndef SCREAMER_BANK_H
+#define SCREAMER_BANK_H
+
+#include <pybind11/pybind11.h>
+#include <pybind11/numpy.h>
+#include <stdexcept>
+
+namespace py = pybind11;
+
+namespace screamer {
+
+    // Base class of banks: n independent series that each receive a new value
+    // at the same time, e.g. the prices of n instruments in a market snapshot.
+    // The state of all series is kept in contiguous arrays, so one call updates
+    // the whole cross-section.
+    //
+    // Banks are always streaming: every call continues from the current state.
+    class ScreamerBank {
+    public:
+
+        explicit ScreamerBank(int n) : n_(n) {
+            if (n < 1) {
+                throw std::invalid_argument("The number of series must be at least 1.");
+            }
+        }
+
+        virtual ~ScreamerBank() = default;
+
+        // virtual function with empty default implementation to reset state
+        virtual void reset() {};
+
+        // Number of series in the bank
+        size_t size() const { return n_; }
+
+        // Process one row x of n new values, one per series, and write the n
+        // results to y.
+        virtual void process_row(double* y, const double* x) = 0;
+
+        // Process a vector of shape (n,) with one new value per series, or a
+        // matrix of shape (T, n) with T consecutive rows. The result has the
+        // same shape.
+        py::array_t<double> operator()(py::array_t<double, py::array::c_style | py::array::forcecast> input) {
+            py::buffer_info buf_info = input.request();
+
+            bool valid_shape =
+                (buf_info.ndim == 1 && static_cast<size_t>(buf_info.shape[0]) == n_) ||
+                (buf_info.ndim == 2 && static_cast<size_t>(buf_info.shape[1]) == n_);
+            if (!valid_shape) {
+                throw std::invalid_argument(
+                    "Input must have shape (n,) or (T, n), with n=" + std::to_string(n_) + " the number of series"
+                );
+            }
+
+            const double* input_data = static_cast<const double*>(buf_info.ptr);
+
+            py::array_t<double> result(buf_info.shape);
+            double* result_data = static_cast<double*>(result.request().ptr);
+
+            size_t rows = (buf_info.ndim == 1) ? 1 : buf_info.shape[0];
+            {
+                py::gil_scoped_release release;
+                for (size_t r = 0; r < rows; ++r) {
+                    process_row(result_data + r * n_, input_data + r * n_);
+                }
+            }
+            return result;
+        }
+
+    protected:
+        const size_t n_;
+    };
+
+}
+
+#endif
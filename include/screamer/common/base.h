@@ -4,6 +4,12 @@
 #include <pybind11/pybind11.h>
 #include <pybind11/numpy.h>
 #include <iostream>
+#include <memory>
+#include <thread>
+#include <vector>
+#include <exception>
+#include <algorithm>
+#include <type_traits>
 
 namespace py = pybind11;
 
@@ -17,32 +23,54 @@ namespace screamer {
         // virtual function with empty default implementation to reset state
         virtual void reset() {};
 
-        py::object operator()(py::object input) {
+        // virtual function that returns an independent copy of this object, used to
+        // give each worker thread its own state. Returns nullptr if not supported.
+        virtual std::unique_ptr<ScreamerBase> clone() const { return nullptr; }
 
-            // scalar types
-            if (py::isinstance<py::float_>(input) ||
-                py::isinstance<py::int_>(input) ||
-                py::isinstance<py::bool_>(input)
-            ) {
-                double value = input.cast<double>();
-                return py::float_(process_scalar(value));
+        // Whether the array methods can write their output into the input buffer,
+        // i.e. out=x. This holds for element-wise operators that read x[i] before
+        // writing y[i] and never look back at older inputs.
+        virtual bool supports_inplace() const { return false; }
+
+        // Number of results per input value of operators that compute several
+        // values at once, like a set of quantiles, or 0 for operators with a
+        // single result. Scalar input then gives a tuple of this size, and
+        // array results get an extra last dimension of this size.
+        virtual size_t output_size() const { return 0; }
+
+        py::object operator()(py::object input, int n_threads = 1, py::object out = py::none()) {
+
+            // out= is only meaningful when we produce an array
+            if (!out.is_none() && !is_array_like(input)) {
+                throw std::invalid_argument("out is only supported for array input");
+            }
+
+            // scalar types, including numpy scalars
+            double value;
+            if (scalar_value(input.ptr(), value)) {
+                return scalar_result(value);
             }
 
             // array types
-            if (py::isinstance<py::array>(input) ||
-                py::isinstance<py::list>(input) ||
-                py::isinstance<py::tuple>(input)
-            ) {
+            if (is_array_like(input)) {
+                // float32 arrays are processed as-is, without widening them to double
+                if (py::isinstance<py::array_t<float>>(input)) {
+                    py::array_t<float> float_array_t = py::reinterpret_borrow<py::array_t<float>>(input);
+                    if (float_array_t.size() > 1 || !out.is_none()) {
+                        return process_python_array(float_array_t, n_threads, out);
+                    }
+                }
+
                 py::array_t<double> double_array_t = py::cast<py::array_t<double>>(input);
                 int size = double_array_t.size();
 
-                if (size > 1) {
-                    return process_python_array(double_array_t);
+                if (size > 1 || !out.is_none()) {
+                    return process_python_array(double_array_t, n_threads, out);
                 } else {
                     py::buffer_info buf_info = double_array_t.request();
                     double* input_data_ptr = static_cast<double*>(buf_info.ptr);
                     double value = input_data_ptr[0];
-                    return py::float_(process_scalar(value));
+                    return scalar_result(value);
                 }
             }
 
@@ -51,22 +79,78 @@ namespace screamer {
                 return py::cast(LazyIterator(input.cast<py::iterable>(), *this));
             }
 
-            // numpy primitive types
-            auto type_str = std::string(py::str(input.get_type()));
-            if (type_str == "<class \'numpy.uint32\'>" ||
-               type_str == "<class \'numpy.uint64\'>" ||
-               type_str == "<class \'numpy.int32\'>" ||
-               type_str == "<class \'numpy.int64\'>" ||
-               type_str == "<class \'numpy.float32\'>" ||
-               type_str == "<class \'numpy.float64\'>") {
-                double value = py::cast<double>(input);
-                return py::float_(process_scalar(value));
-            }
-
             // unknow other types
             throw std::invalid_argument("Unsupported input type for call");
         }
 
+        // Process a single new value, the typed fast path for streaming. Python
+        // floats are converted by pybind11 without any further type dispatch.
+        py::object update(double value) {
+            return scalar_result(value);
+        }
+
+        // Process a 1-dimensional array of new values continuing from the current
+        // state, and keep the updated state for the next call. Feeding a series in
+        // chunks gives exactly the same results as feeding it value by value.
+        // Scalars that don't convert to double directly, like numpy scalars, also
+        // end up here.
+        py::object update(py::object input, py::object out = py::none()) {
+
+            double value;
+            if (out.is_none() && scalar_value(input.ptr(), value)) {
+                return scalar_result(value);
+            }
+
+            // float32 arrays are processed as-is, without widening them to double
+            if (py::isinstance<py::array_t<float>>(input)) {
+                return process_python_array(
+                    py::reinterpret_borrow<py::array_t<float>>(input), 1, out, true
+                );
+            }
+
+            if (is_array_like(input)) {
+                return process_python_array(
+                    py::cast<py::array_t<double>>(input), 1, out, true
+                );
+            }
+
+            throw std::invalid_argument("update expects a scalar or a 1-dimensional array");
+        }
+
+        // Get the value of a Python float, int, bool, or numpy number scalar with
+        // direct C API type checks. Returns false for other types.
+        static bool scalar_value(PyObject* obj, double& value) {
+            if (PyFloat_Check(obj)) {
+                value = PyFloat_AS_DOUBLE(obj);
+                return true;
+            }
+            if (PyLong_Check(obj)) {
+                value = PyLong_AsDouble(obj);
+                if (value == -1.0 && PyErr_Occurred()) throw py::error_already_set();
+                return true;
+            }
+
+            // numpy.number, looked up once. We don't keep numpy loaded if it wasn't.
+            static PyObject* numpy_number = []() -> PyObject* {
+                PyObject* numpy = PyImport_ImportModule("numpy");
+                if (!numpy) {
+                    PyErr_Clear();
+                    return nullptr;
+                }
+                PyObject* number = PyObject_GetAttrString(numpy, "number");
+                Py_DECREF(numpy);
+                if (!number) PyErr_Clear();
+                return number;
+            }();
+
+            if (numpy_number && PyObject_TypeCheck(obj, reinterpret_cast<PyTypeObject*>(numpy_number))) {
+                value = PyFloat_AsDouble(obj);
+                if (value == -1.0 && PyErr_Occurred()) throw py::error_already_set();
+                return true;
+            }
+            return false;
+        }
+
         class LazyIterator {
         public:
             LazyIterator(py::iterable iterable, ScreamerBase& processor)
@@ -81,7 +165,7 @@ namespace screamer {
                     // Get the next item by calling the Python iterator's __next__ method
                     py::object item = iterator_.attr("__next__")();
                     double value = item.cast<double>();
-                    return py::float_(processor_.process_scalar(value));
+                    return processor_.scalar_result(value);
                 } catch (py::error_already_set &e) {
                     if (e.matches(PyExc_StopIteration)) {
                         throw py::stop_iteration();
@@ -99,6 +183,38 @@ namespace screamer {
         // Pure virtual function to process a single scalar
         virtual double process_scalar(double value) = 0;
 
+        // Process a single scalar into output_size() results, only called when
+        // output_size() > 0.
+        virtual void process_scalar_multi(double value, double* results) {
+            results[0] = process_scalar(value);
+        }
+
+        // Process an array into output_size() results per value, result j of
+        // value i goes to result_data[i * result_stride + j * output_stride].
+        // Used for both fresh and continued processing, like process_array_update.
+        // Defaults to looping with process_scalar_multi.
+        virtual void process_array_multi(
+            double* result_data,
+            size_t result_stride,
+            size_t output_stride,
+            const double* input_data,
+            size_t input_stride,
+            size_t size) {
+
+            array_multi(result_data, result_stride, output_stride, input_data, input_stride, size);
+        }
+
+        virtual void process_array_multi(
+            float* result_data,
+            size_t result_stride,
+            size_t output_stride,
+            const float* input_data,
+            size_t input_stride,
+            size_t size) {
+
+            array_multi(result_data, result_stride, output_stride, input_data, input_stride, size);
+        }
+
         // Virtual function to process an array in contiguous memory (no strides)
         // defaulting to looping with process_scalar.
         virtual void process_array_no_stride(
@@ -132,25 +248,171 @@ namespace screamer {
            
         }
 
+        // float32 versions of the array functions. State and accumulators stay in
+        // double, only the input and output are float.
+        virtual void process_array_no_stride(
+            float* result_data, 
+            const float* input_data,
+            size_t size) {
+
+            for (size_t i=0; i<size; i++) {
+                result_data[i] = static_cast<float>(process_scalar(input_data[i]));
+            }
+        }
+
+        virtual void process_array_stride(
+            float* result_data, 
+            size_t result_stride,
+            const float* input_data, 
+            size_t input_stride,
+            size_t size) {
+
+            size_t result_start = 0;
+            size_t input_start = 0;
+
+            for (size_t i = 0; i < size; i++) {
+                result_data[result_start] = static_cast<float>(process_scalar(input_data[input_start]));
+                result_start += result_stride;
+                input_start += input_stride;
+            }
+        }
+
+        // Process new values continuing from the current state, used by update().
+        // Unlike process_array_no_stride and process_array_stride, which are always
+        // called on a freshly reset object and are allowed to take shortcuts based
+        // on that, this must leave the state as if each value was passed to
+        // process_scalar. The result may be written into the input buffer, i.e.
+        // result_data == input_data. Defaults to looping with process_scalar.
+        virtual void process_array_update(
+            double* result_data, 
+            size_t result_stride,
+            const double* input_data, 
+            size_t input_stride,
+            size_t size) {
+
+            for (size_t i = 0; i < size; i++) {
+                result_data[i * result_stride] = process_scalar(input_data[i * input_stride]);
+            }
+        }
+
+        virtual void process_array_update(
+            float* result_data, 
+            size_t result_stride,
+            const float* input_data, 
+            size_t input_stride,
+            size_t size) {
+
+            for (size_t i = 0; i < size; i++) {
+                result_data[i * result_stride] = static_cast<float>(process_scalar(input_data[i * input_stride]));
+            }
+        }
+
+        // Virtual function that tells if process_array_panel is implemented.
+        virtual bool has_panel_kernel() const { return false; }
+
+        // Virtual function to process a row-major panel of independent series, one
+        // series per column. Row r of x starts at x + r * dx and the cols values in a row
+        // are contiguous, so a kernel can keep a vector of per-column states and update a
+        // whole row at once. Must not modify the object: it is called concurrently from
+        // multiple threads on disjoint column blocks.
+        virtual void process_array_panel(
+            double* /*result_data*/,
+            size_t /*result_row_stride*/,
+            const double* /*input_data*/,
+            size_t /*input_row_stride*/,
+            size_t /*rows*/,
+            size_t /*cols*/) const {}
+
+        // Number of columns panel kernels process at once, the per-column states of
+        // a tile stay in L1 while we walk down the rows
+        static constexpr size_t panel_tile_cols = 256;
+
     protected:
+        // The two-input base in base2.h shares the array helpers below
+        friend class ScreamerBase2;
 
-        // function for numpy array processing
-        py::array_t<double> process_python_array(py::array_t<double> input_array) {
+        // The result of a scalar: a float, or a tuple of floats if output_size() > 0
+        py::object scalar_result(double value) {
+            size_t k = output_size();
+            if (k == 0) {
+                return py::float_(process_scalar(value));
+            }
+            std::vector<double> results(k);
+            process_scalar_multi(value, results.data());
+            py::tuple tuple(k);
+            for (size_t j = 0; j < k; j++) {
+                tuple[j] = py::float_(results[j]);
+            }
+            return tuple;
+        }
+
+        template <typename T>
+        void array_multi(T* y, size_t dy, size_t dk, const T* x, size_t dx, size_t size) {
+            size_t k = output_size();
+            std::vector<double> results(k);
+            for (size_t i = 0; i < size; i++) {
+                process_scalar_multi(x[i * dx], results.data());
+                for (size_t j = 0; j < k; j++) {
+                    y[i * dy + j * dk] = static_cast<T>(results[j]);
+                }
+            }
+        }
+
+        // function for numpy array processing. The GIL is released while the
+        // buffers are processed, so different objects can be used concurrently
+        // from different Python threads. A single object is not thread safe.
+        //
+        // Columns of multidimensional arrays are independent series, with n_threads
+        // other than 1 they are split over worker threads that each use their own
+        // clone of this object. n_threads <= 0 uses all hardware threads.
+        //
+        // If out is not None the result is written into it instead of a newly
+        // allocated array. out must be a writeable array with the shape and dtype
+        // of the result, it can be the input itself if supports_inplace().
+        //
+        // T is double or float, the result has the same type as the input.
+        //
+        // With keep_state the array must be 1-dimensional, it is processed from the
+        // current state and the state is not reset afterwards, see update().
+        template <typename T>
+        py::array_t<T> process_python_array(
+            py::array_t<T> input_array, 
+            int n_threads = 1, 
+            py::object out = py::none(),
+            bool keep_state = false) 
+        {
             // Inspect the input
             py::buffer_info buf_info = input_array.request();
 
             // Ensure that the input array has at least one dimension
-            if (buf_info.ndim < 1 || buf_info.itemsize != sizeof(double)) {
-                throw std::runtime_error("Input array must have at least one dimension and contain doubles");
+            if (buf_info.ndim < 1 || buf_info.itemsize != sizeof(T)) {
+                throw std::runtime_error("Input array must have at least one dimension and contain floating point values");
+            }
+            if (keep_state && buf_info.ndim != 1) {
+                throw std::invalid_argument("update expects a 1-dimensional array");
+            }
+            if (output_size() > 0) {
+                return process_python_array_multi(input_array, n_threads, out, keep_state);
             }
-            
-            // Get access to the data of the input
-            double* input_data = static_cast<double*>(buf_info.ptr);
 
-            // Create an output array of the same shape as the input
-            py::array_t<double> result(buf_info.shape);
-            py::buffer_info result_buf = result.request();
-            double* result_data = static_cast<double*>(result_buf.ptr);
+            // Create an output array of the same shape as the input, or use out
+            py::array_t<T> result = result_array<T>(out, buf_info.shape);
+            py::buffer_info result_buf = result.request(true);
+
+            // When the output overlaps with the input we work on a copy of the
+            // input, unless it's exactly the same buffer and we can do in-place.
+            // The value by value loop of keep_state is always safe in-place.
+            if (!out.is_none() && buffers_overlap(buf_info, result_buf)) {
+                bool same_buffer = (buf_info.ptr == result_buf.ptr) && (buf_info.strides == result_buf.strides);
+                if (!(same_buffer && (keep_state || supports_inplace()))) {
+                    input_array = input_array.attr("copy")().template cast<py::array_t<T>>();
+                    buf_info = input_array.request();
+                }
+            }
+
+            // Get access to the data of the input and output
+            T* input_data = static_cast<T*>(buf_info.ptr);
+            T* result_data = static_cast<T*>(result_buf.ptr);
 
             // The size along the first dimension
             size_t size = buf_info.shape[0];
@@ -160,77 +422,422 @@ namespace screamer {
                 return result;
             }
 
-            // If this is a contiguous 1d array then we have optimized code!
-            if (buf_info.ndim == 1 && buf_info.strides[0] == sizeof(double)) {
-                reset(); // we do this in the base class, to ensure consistent behaviour
-                process_array_no_stride(result_data, input_data, size);
-                reset();
+            // From here on we only touch the raw double buffers, so we release the
+            // GIL and let other Python threads run while we crunch numbers. Both
+            // buffers stay alive because we hold references to input_array and result.
+            {
+                py::gil_scoped_release release;
+
+                if (keep_state) {
+                    process_array_update(
+                        result_data, result_buf.strides[0] / static_cast<py::ssize_t>(sizeof(T)),
+                        input_data, buf_info.strides[0] / static_cast<py::ssize_t>(sizeof(T)),
+                        size
+                    );
+                }
+                // If this is a contiguous 1d array then we have optimized code!
+                else if (buf_info.ndim == 1 && 
+                    buf_info.strides[0] == sizeof(T) && 
+                    result_buf.strides[0] == sizeof(T)
+                ) {
+                    reset(); // we do this in the base class, to ensure consistent behaviour
+                    process_array_no_stride(result_data, input_data, size);
+                    reset();
+                } else if (
+                    std::is_same<T, double>::value &&
+                    buf_info.ndim == 2 && buf_info.shape[1] > 1 &&
+                    buf_info.strides[1] == sizeof(T) && buf_info.strides[0] > 0 &&
+                    result_buf.strides[1] == sizeof(T) && result_buf.strides[0] > 0 &&
+                    has_panel_kernel()
+                ) {
+                    // Row-major (time x series) data, process whole rows at once.
+                    // Panel kernels are double only.
+                    process_panel(
+                        reinterpret_cast<double*>(result_data), result_buf.strides[0] / sizeof(T),
+                        reinterpret_cast<const double*>(input_data), buf_info.strides[0] / sizeof(T),
+                        size, buf_info.shape[1], n_threads
+                    );
+                    reset();
+                } else {
+                    process_columns(result_data, result_buf, input_data, buf_info, size, n_threads);
+                }
+            }
+
+            return result;
+
+        }
+
+        // Array processing for output_size() > 0: the result has the shape of the
+        // input with an extra last dimension of output_size() values.
+        template <typename T>
+        py::array_t<T> process_python_array_multi(
+            py::array_t<T> input_array,
+            int n_threads,
+            py::object out,
+            bool keep_state)
+        {
+            py::buffer_info buf_info = input_array.request();
+
+            std::vector<py::ssize_t> shape = buf_info.shape;
+            shape.push_back(static_cast<py::ssize_t>(output_size()));
+
+            py::array_t<T> result = result_array<T>(out, shape);
+            py::buffer_info result_buf = result.request(true);
 
+            // The result has a different shape, so it can never share the input buffer
+            if (!out.is_none() && buffers_overlap(buf_info, result_buf)) {
+                input_array = input_array.attr("copy")().template cast<py::array_t<T>>();
+                buf_info = input_array.request();
+            }
+
+            T* input_data = static_cast<T*>(buf_info.ptr);
+            T* result_data = static_cast<T*>(result_buf.ptr);
+            size_t size = buf_info.shape[0];
+            size_t output_stride = result_buf.strides[buf_info.ndim] / static_cast<py::ssize_t>(sizeof(T));
+
+            if (size == 0) {
                 return result;
             }
 
-            // We have multidimensional and/or strided data
+            {
+                py::gil_scoped_release release;
+
+                if (keep_state) {
+                    process_array_multi(
+                        result_data, result_buf.strides[0] / static_cast<py::ssize_t>(sizeof(T)), output_stride,
+                        input_data, buf_info.strides[0] / static_cast<py::ssize_t>(sizeof(T)),
+                        size
+                    );
+                } else {
+                    for_each_column(result_data, result_buf, input_data, buf_info, n_threads,
+                        [&](ScreamerBase* obj, T* y, size_t dy, const T* x, size_t dx) {
+                            obj->reset();
+                            obj->process_array_multi(y, dy, output_stride, x, dx, size);
+                        }
+                    );
+                    reset();
+                }
+            }
+
+            return result;
+        }
+
+        // Whether the input is processed as an array
+        static bool is_array_like(const py::object& obj) {
+            return py::isinstance<py::array>(obj) || py::isinstance<py::list>(obj) || py::isinstance<py::tuple>(obj);
+        }
+
+        // A new result array of the given shape, or out after checking it
+        template <typename T>
+        static py::array_t<T> result_array(py::object out, const std::vector<py::ssize_t>& shape) {
+            if (out.is_none()) {
+                return py::array_t<T>(shape);
+            }
+            return checked_out_array<T>(out, shape);
+        }
+
+        // Validate a user supplied out= array against the shape of the result
+        template <typename T>
+        static py::array_t<T> checked_out_array(py::object out, const std::vector<py::ssize_t>& shape) {
+            if (!py::isinstance<py::array_t<T>>(out)) {
+                throw py::type_error(
+                    std::is_same<T, float>::value ?
+                    "out must be a numpy array of dtype float32" :
+                    "out must be a numpy array of dtype float64"
+                );
+            }
+            py::array_t<T> result = py::reinterpret_borrow<py::array_t<T>>(out);
+
+            if (!result.writeable()) {
+                throw py::value_error("out must be a writeable array");
+            }
 
+            bool same_shape = (result.ndim() == static_cast<py::ssize_t>(shape.size()));
+            for (py::ssize_t i = 0; same_shape && i < result.ndim(); ++i) {
+                same_shape = (result.shape(i) == shape[i]);
+            }
+            if (!same_shape) {
+                throw py::value_error("out must have the shape of the result");
+            }
+            return result;
+        }
+
+        // Whether the memory spanned by two buffers overlaps
+        static bool buffers_overlap(const py::buffer_info& a, const py::buffer_info& b) {
+            auto extent = [](const py::buffer_info& buf, const char*& lo, const char*& hi) {
+                lo = hi = static_cast<const char*>(buf.ptr);
+                for (py::ssize_t i = 0; i < buf.ndim; ++i) {
+                    py::ssize_t span = buf.strides[i] * (buf.shape[i] - 1);
+                    if (span < 0) lo += span; else hi += span;
+                }
+                hi += buf.itemsize;
+            };
+            const char *a_lo, *a_hi, *b_lo, *b_hi;
+            extent(a, a_lo, a_hi);
+            extent(b, b_lo, b_hi);
+            return (a_lo < b_hi) && (b_lo < a_hi);
+        }
+
+        // Apply the function to each column of a multidimensional and/or strided
+        // array. This runs without the GIL, so it must not touch Python objects.
+        template <typename T>
+        void process_columns(
+            T* result_data,
+            const py::buffer_info& result_buf,
+            const T* input_data,
+            const py::buffer_info& buf_info,
+            size_t size,
+            int n_threads)
+        {
+            for_each_column(result_data, result_buf, input_data, buf_info, n_threads,
+                [size](ScreamerBase* obj, T* y, size_t dy, const T* x, size_t dx) {
+                    obj->reset(); // we do this in the base class to ensure consistent behaviour
+                    obj->process_array_stride(y, dy, x, dx, size);
+                }
+            );
+
+            reset(); // post-columns processing reset
+        }
+
+        // Call process_column(obj, y, dy, x, dx) for each column of the input,
+        // with x the start of the column, dx the stride along the first
+        // dimension, and y, dy the same for the result. The result may have
+        // extra trailing dimensions. With n_threads other than 1 the columns are
+        // split over workers, obj is this object or a clone per worker.
+        template <typename T, typename F>
+        void for_each_column(
+            T* result_data,
+            const py::buffer_info& result_buf,
+            const T* input_data,
+            const py::buffer_info& buf_info,
+            int n_threads,
+            F process_column)
+        {
+            // Strides along the first dimension in terms of the number of elements
+            size_t input_stride = buf_info.strides[0] / static_cast<py::ssize_t>(sizeof(T));
+            size_t result_stride = result_buf.strides[0] / static_cast<py::ssize_t>(sizeof(T));
+
+            run_columns(this, buf_info, n_threads, [&](ScreamerBase* obj, size_t col) {
+                process_column(
+                    obj,
+                    result_data + column_offset(buf_info, result_buf, col),
+                    result_stride,
+                    input_data + column_offset(buf_info, buf_info, col),
+                    input_stride
+                );
+            });
+        }
+
+        // Call f(obj, col) for each column col of an array with the shape of
+        // buf_info, the columns are the series along the first dimension.
+        // With n_threads other than 1 the columns are split over workers that
+        // each use their own object: self for the first, and a clone of self
+        // for the others. Also used by the two-input base with its own clones.
+        template <typename Obj, typename F>
+        static void run_columns(Obj* self, const py::buffer_info& buf_info, int n_threads, F f)
+        {
             // Total size of the rest of the dimensions
-            size_t rest_size = 1;  
+            size_t rest_size = 1;
             for (int i = 1; i < buf_info.ndim; ++i) {
                 rest_size *= buf_info.shape[i];
             }
 
-            // Compute the strides in terms of the number of elements
-            std::vector<size_t> input_strides(buf_info.ndim);
-            std::vector<size_t> result_strides(buf_info.ndim);
+            // Decide how many workers we use, never more than there are columns
+            size_t num_workers = resolve_num_workers(n_threads, rest_size);
+
+            // Each worker needs its own state, fall back to serial if we can't clone
+            std::vector<std::unique_ptr<Obj>> clones;
+            for (size_t w = 1; w < num_workers; ++w) {
+                std::unique_ptr<Obj> c = self->clone();
+                if (!c) {
+                    clones.clear();
+                    num_workers = 1;
+                    break;
+                }
+                clones.push_back(std::move(c));
+            }
+
+            // Worker w gets a contiguous block of columns and uses its own object
+            run_workers(num_workers, [&](size_t w) {
+                Obj* obj = (w == 0) ? self : clones[w - 1].get();
+                size_t col_begin = w * rest_size / num_workers;
+                size_t col_end = (w + 1) * rest_size / num_workers;
+
+                for (size_t col = col_begin; col < col_end; ++col) {
+                    f(obj, col);
+                }
+            });
+        }
 
-            for (int i = 0; i < buf_info.ndim; ++i) {
-                input_strides[i] = buf_info.strides[i] / sizeof(double);
-                result_strides[i] = result_buf.strides[i] / sizeof(double);
+        // The offset in elements of the start of column col in buf, for the
+        // columns of an array with the shape of shape_buf. buf may have extra
+        // trailing dimensions, like the results of operators with several
+        // results per value.
+        static py::ssize_t column_offset(const py::buffer_info& shape_buf, const py::buffer_info& buf, size_t col) {
+            py::ssize_t offset = 0;
+            for (int dim = shape_buf.ndim - 1; dim > 0; --dim) {
+                py::ssize_t index_in_dim = col % shape_buf.shape[dim];
+                offset += index_in_dim * (buf.strides[dim] / buf.itemsize);
+                col /= shape_buf.shape[dim];
             }
+            return offset;
+        }
 
-            // Precompute column offsets
-            std::vector<size_t> col_input_offsets(rest_size);
-            std::vector<size_t> col_result_offsets(rest_size);
+        // Process a row-major panel with the panel kernel, splitting the columns in
+        // blocks over n_threads workers. Panel kernels don't touch the object state,
+        // so all workers can share this object. Runs without the GIL.
+        void process_panel(
+            double* result_data,
+            size_t result_row_stride,
+            const double* input_data,
+            size_t input_row_stride,
+            size_t rows,
+            size_t cols,
+            int n_threads)
+        {
+            size_t num_workers = resolve_num_workers(n_threads, cols);
+
+            run_workers(num_workers, [&](size_t w) {
+                size_t col_begin = w * cols / num_workers;
+                size_t col_end = (w + 1) * cols / num_workers;
+
+                process_array_panel(
+                    result_data + col_begin, result_row_stride,
+                    input_data + col_begin, input_row_stride,
+                    rows, col_end - col_begin
+                );
+            });
+        }
 
-            for (size_t col = 0; col < rest_size; ++col) {
-                size_t temp_col = col;
-                size_t col_input_offset = 0;
-                size_t col_result_offset = 0;
+        // Number of workers for n_threads, never more than max_workers.
+        // n_threads <= 0 means all hardware threads.
+        static size_t resolve_num_workers(int n_threads, size_t max_workers) {
+            size_t num_workers = (n_threads > 0) ? n_threads : std::thread::hardware_concurrency();
+            return std::max<size_t>(1, std::min(num_workers, max_workers));
+        }
 
-                for (int dim = buf_info.ndim - 1; dim > 0; --dim) {
-                    size_t index_in_dim = temp_col % buf_info.shape[dim];
-                    col_input_offset += index_in_dim * input_strides[dim];
-                    col_result_offset += index_in_dim * result_strides[dim];
-                    temp_col /= buf_info.shape[dim];
-                }
+        // Run f(w) for each worker w in [0, num_workers), worker 0 runs on the calling
+        // thread. Exceptions thrown by workers are rethrown after all have finished.
+        template <typename F>
+        static void run_workers(size_t num_workers, F f) {
+            if (num_workers <= 1) {
+                f(0);
+                return;
+            }
 
-                col_input_offsets[col] = col_input_offset;
-                col_result_offsets[col] = col_result_offset;
+            std::vector<std::thread> workers;
+            std::vector<std::exception_ptr> errors(num_workers);
+
+            for (size_t w = 1; w < num_workers; ++w) {
+                workers.emplace_back([&f, &errors, w]() {
+                    try {
+                        f(w);
+                    } catch (...) {
+                        errors[w] = std::current_exception();
+                    }
+                });
             }
 
-            // Apply the function to each column
-            for (size_t col = 0; col < rest_size; ++col) {
+            try {
+                f(0);
+            } catch (...) {
+                errors[0] = std::current_exception();
+            }
 
-                // Initialize indices with precomputed offsets
-                size_t input_index = col_input_offsets[col];
-                size_t result_index = col_result_offsets[col];
+            for (auto& t : workers) {
+                t.join();
+            }
 
-                reset(); // we do this in the base class to ensure consistent behaviour
+            for (auto& e : errors) {
+                if (e) std::rethrow_exception(e);
+            }
+        }
 
-                process_array_stride(
-                    &result_data[result_index], 
-                    result_strides[0],
-                    &input_data[input_index], 
-                    input_strides[0],
-                    size
-                );
 
-            } 
-            reset(); // post-columns processing reset
+    };
 
-            return result;
 
+    // CRTP helper that implements clone() with the copy constructor of Derived.
+    template <typename Derived>
+    class ScreamerClonable : public ScreamerBase {
+    public:
+        std::unique_ptr<ScreamerBase> clone() const override {
+            return std::make_unique<Derived>(static_cast<const Derived&>(*this));
         }
+    };
 
 
+    // CRTP base for operators. Derived implements the non-virtual
+    //
+    //     double step(double value)
+    //
+    // that updates the state with one new value and returns the result. The array
+    // loops below call Derived::step statically, so the compiler can inline the step
+    // and optimize the loop instead of making a virtual call per element.
+    //
+    // The loops are templates on the value type T (double or float), Derived can
+    // replace them with specialized kernels by defining its own
+    //
+    //     template <typename T> void array_no_stride(T* y, const T* x, size_t size)
+    //     template <typename T> void array_stride(T* y, size_t dy, const T* x, size_t dx, size_t size)
+    //
+    // or by overriding the virtual process_array_* functions directly.
+    template <typename Derived>
+    class ScreamerKernel : public ScreamerClonable<Derived> {
+    public:
+        double process_scalar(double value) override {
+            return derived().step(value);
+        }
+
+        void process_array_no_stride(double* y, const double* x, size_t size) override {
+            derived().template array_no_stride<double>(y, x, size);
+        }
+
+        void process_array_no_stride(float* y, const float* x, size_t size) override {
+            derived().template array_no_stride<float>(y, x, size);
+        }
+
+        void process_array_stride(double* y, size_t dy, const double* x, size_t dx, size_t size) override {
+            derived().template array_stride<double>(y, dy, x, dx, size);
+        }
+
+        void process_array_stride(float* y, size_t dy, const float* x, size_t dx, size_t size) override {
+            derived().template array_stride<float>(y, dy, x, dx, size);
+        }
+
+        // update() always uses the step loop: array kernels of Derived may assume
+        // they start from a reset state
+        void process_array_update(double* y, size_t dy, const double* x, size_t dx, size_t size) override {
+            ScreamerKernel::array_stride<double>(y, dy, x, dx, size);
+        }
+
+        void process_array_update(float* y, size_t dy, const float* x, size_t dx, size_t size) override {
+            ScreamerKernel::array_stride<float>(y, dy, x, dx, size);
+        }
+
+        template <typename T>
+        void array_no_stride(T* y, const T* x, size_t size) {
+            Derived& d = derived();
+            for (size_t i = 0; i < size; i++) {
+                y[i] = static_cast<T>(d.step(x[i]));
+            }
+        }
+
+        template <typename T>
+        void array_stride(T* y, size_t dy, const T* x, size_t dx, size_t size) {
+            Derived& d = derived();
+            size_t yi = 0;
+            size_t xi = 0;
+
+            for (size_t i = 0; i < size; i++) {
+                y[yi] = static_cast<T>(d.step(x[xi]));
+                yi += dy;
+                xi += dx;
+            }
+        }
+
+    private:
+        Derived& derived() { return static_cast<Derived&>(*this); }
     };
 
 }
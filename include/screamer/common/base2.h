@@ -0,0 +1,401 @@
+#ifndef SCREAMER_BASE2_H
+#define SCREAMER_BASE2_H
+
+#include <pybind11/pybind11.h>
+#include <pybind11/numpy.h>
+#include <memory>
+#include <vector>
+#include <algorithm>
+#include <type_traits>
+#include "screamer/common/base.h"
+
+namespace py = pybind11;
+
+namespace screamer {
+
+    // Base class of operators on two aligned series x and y, like the rolling
+    // covariance. The call dispatches like ScreamerBase: two scalars give a
+    // float, two arrays of the same shape give an array of that shape, with the
+    // columns of multidimensional arrays as independent pairs of series, and
+    // two iterables give a lazy iterator over the zipped values.
+    class ScreamerBase2 {
+    public:
+
+        virtual ~ScreamerBase2() = default;
+
+        // virtual function with empty default implementation to reset state
+        virtual void reset() {};
+
+        // virtual function that returns an independent copy of this object, used to
+        // give each worker thread its own state. Returns nullptr if not supported.
+        virtual std::unique_ptr<ScreamerBase2> clone() const { return nullptr; }
+
+        py::object operator()(py::object x, py::object y, int n_threads = 1, py::object out = py::none()) {
+
+            // scalar types, including numpy scalars
+            double x_value;
+            double y_value;
+            bool x_scalar = ScreamerBase::scalar_value(x.ptr(), x_value);
+            bool y_scalar = ScreamerBase::scalar_value(y.ptr(), y_value);
+            if (x_scalar && y_scalar) {
+                if (!out.is_none()) {
+                    throw std::invalid_argument("out is only supported for array input");
+                }
+                return py::float_(process_scalar(x_value, y_value));
+            }
+
+            // array types
+            if (!x_scalar && !y_scalar && ScreamerBase::is_array_like(x) && ScreamerBase::is_array_like(y)) {
+                return process_python_arrays(x, y, n_threads, out, false);
+            }
+
+            // iterator / generator types
+            if (!x_scalar && !y_scalar && out.is_none() &&
+                py::isinstance<py::iterable>(x) && py::isinstance<py::iterable>(y)
+            ) {
+                return py::cast(LazyIterator(x.cast<py::iterable>(), y.cast<py::iterable>(), *this));
+            }
+
+            throw std::invalid_argument("x and y must both be scalars, arrays of the same shape, or iterables");
+        }
+
+        // Process a single pair of new values, the typed fast path for streaming
+        double update(double x, double y) {
+            return process_scalar(x, y);
+        }
+
+        // Process 1-dimensional arrays of new values continuing from the current
+        // state, and keep the updated state for the next call, see
+        // ScreamerBase::update()
+        py::object update(py::object x, py::object y, py::object out = py::none()) {
+
+            double x_value;
+            double y_value;
+            if (out.is_none() &&
+                ScreamerBase::scalar_value(x.ptr(), x_value) &&
+                ScreamerBase::scalar_value(y.ptr(), y_value)
+            ) {
+                return py::float_(process_scalar(x_value, y_value));
+            }
+
+            if (ScreamerBase::is_array_like(x) && ScreamerBase::is_array_like(y)) {
+                return process_python_arrays(x, y, 1, out, true);
+            }
+
+            throw std::invalid_argument("update expects two scalars or two 1-dimensional arrays");
+        }
+
+        class LazyIterator {
+        public:
+            LazyIterator(py::iterable x, py::iterable y, ScreamerBase2& processor)
+                : x_(py::iter(x)), y_(py::iter(y)), processor_(processor) {}
+
+            // __iter__ method
+            LazyIterator& __iter__() { return *this; }
+
+            // __next__ method, stops at the end of the shorter iterable
+            py::object __next__() {
+                try {
+                    double x_value = x_.attr("__next__")().cast<double>();
+                    double y_value = y_.attr("__next__")().cast<double>();
+                    return py::float_(processor_.process_scalar(x_value, y_value));
+                } catch (py::error_already_set &e) {
+                    if (e.matches(PyExc_StopIteration)) {
+                        throw py::stop_iteration();
+                    } else {
+                        throw;  // Re-throw other exceptions
+                    }
+                }
+            }
+
+        private:
+            py::iterator x_;
+            py::iterator y_;
+            ScreamerBase2& processor_;
+        };
+
+        // Pure virtual function to process a single pair of scalars
+        virtual double process_scalar(double x, double y) = 0;
+
+        // Process arrays in contiguous memory, always called on a freshly
+        // reset object, defaulting to looping with process_scalar.
+        virtual void process_array_no_stride(
+            double* result_data,
+            const double* x_data,
+            const double* y_data,
+            size_t size) {
+
+            for (size_t i = 0; i < size; i++) {
+                result_data[i] = process_scalar(x_data[i], y_data[i]);
+            }
+        }
+
+        virtual void process_array_no_stride(
+            float* result_data,
+            const float* x_data,
+            const float* y_data,
+            size_t size) {
+
+            for (size_t i = 0; i < size; i++) {
+                result_data[i] = static_cast<float>(process_scalar(x_data[i], y_data[i]));
+            }
+        }
+
+        // Process arrays with strided elements, always called on a freshly
+        // reset object, defaulting to looping with process_scalar.
+        virtual void process_array_stride(
+            double* result_data,
+            size_t result_stride,
+            const double* x_data,
+            size_t x_stride,
+            const double* y_data,
+            size_t y_stride,
+            size_t size) {
+
+            for (size_t i = 0; i < size; i++) {
+                result_data[i * result_stride] = process_scalar(x_data[i * x_stride], y_data[i * y_stride]);
+            }
+        }
+
+        virtual void process_array_stride(
+            float* result_data,
+            size_t result_stride,
+            const float* x_data,
+            size_t x_stride,
+            const float* y_data,
+            size_t y_stride,
+            size_t size) {
+
+            for (size_t i = 0; i < size; i++) {
+                result_data[i * result_stride] = static_cast<float>(process_scalar(x_data[i * x_stride], y_data[i * y_stride]));
+            }
+        }
+
+        // Process new values continuing from the current state, used by
+        // update(), see ScreamerBase::process_array_update. Defaults to looping
+        // with process_scalar.
+        virtual void process_array_update(
+            double* result_data,
+            size_t result_stride,
+            const double* x_data,
+            size_t x_stride,
+            const double* y_data,
+            size_t y_stride,
+            size_t size) {
+
+            for (size_t i = 0; i < size; i++) {
+                result_data[i * result_stride] = process_scalar(x_data[i * x_stride], y_data[i * y_stride]);
+            }
+        }
+
+        virtual void process_array_update(
+            float* result_data,
+            size_t result_stride,
+            const float* x_data,
+            size_t x_stride,
+            const float* y_data,
+            size_t y_stride,
+            size_t size) {
+
+            for (size_t i = 0; i < size; i++) {
+                result_data[i * result_stride] = static_cast<float>(process_scalar(x_data[i * x_stride], y_data[i * y_stride]));
+            }
+        }
+
+    protected:
+
+        // float32 arrays are processed as-is, without widening them to double,
+        // if both x and y are float32
+        py::object process_python_arrays(py::object x, py::object y, int n_threads, py::object out, bool keep_state) {
+            if (py::isinstance<py::array_t<float>>(x) && py::isinstance<py::array_t<float>>(y)) {
+                return process_python_array(
+                    py::reinterpret_borrow<py::array_t<float>>(x),
+                    py::reinterpret_borrow<py::array_t<float>>(y),
+                    n_threads, out, keep_state
+                );
+            }
+            return process_python_array(
+                py::cast<py::array_t<double>>(x),
+                py::cast<py::array_t<double>>(y),
+                n_threads, out, keep_state
+            );
+        }
+
+        // Process two arrays of the same shape, see
+        // ScreamerBase::process_python_array. The result has the shape of the
+        // inputs and the dtype T of both.
+        template <typename T>
+        py::array_t<T> process_python_array(
+            py::array_t<T> x_array,
+            py::array_t<T> y_array,
+            int n_threads = 1,
+            py::object out = py::none(),
+            bool keep_state = false)
+        {
+            py::buffer_info x_buf = x_array.request();
+            py::buffer_info y_buf = y_array.request();
+
+            if (x_buf.ndim < 1 || x_buf.itemsize != sizeof(T) || y_buf.itemsize != sizeof(T)) {
+                throw std::runtime_error("Input arrays must have at least one dimension and contain floating point values");
+            }
+            if (x_buf.shape != y_buf.shape) {
+                throw std::invalid_argument("x and y must have the same shape");
+            }
+            if (keep_state && x_buf.ndim != 1) {
+                throw std::invalid_argument("update expects 1-dimensional arrays");
+            }
+
+            py::array_t<T> result = ScreamerBase::result_array<T>(out, x_buf.shape);
+            py::buffer_info result_buf = result.request(true);
+
+            // Outputs that overlap an input get a copy of that input, the
+            // kernels look back at older inputs
+            if (!out.is_none()) {
+                if (ScreamerBase::buffers_overlap(x_buf, result_buf)) {
+                    x_array = x_array.attr("copy")().template cast<py::array_t<T>>();
+                    x_buf = x_array.request();
+                }
+                if (ScreamerBase::buffers_overlap(y_buf, result_buf)) {
+                    y_array = y_array.attr("copy")().template cast<py::array_t<T>>();
+                    y_buf = y_array.request();
+                }
+            }
+
+            const T* x_data = static_cast<const T*>(x_buf.ptr);
+            const T* y_data = static_cast<const T*>(y_buf.ptr);
+            T* result_data = static_cast<T*>(result_buf.ptr);
+            size_t size = x_buf.shape[0];
+
+            if (size == 0) {
+                return result;
+            }
+
+            {
+                py::gil_scoped_release release;
+
+                if (keep_state) {
+                    process_array_update(
+                        result_data, result_buf.strides[0] / static_cast<py::ssize_t>(sizeof(T)),
+                        x_data, x_buf.strides[0] / static_cast<py::ssize_t>(sizeof(T)),
+                        y_data, y_buf.strides[0] / static_cast<py::ssize_t>(sizeof(T)),
+                        size
+                    );
+                }
+                else if (x_buf.ndim == 1 &&
+                    x_buf.strides[0] == sizeof(T) &&
+                    y_buf.strides[0] == sizeof(T) &&
+                    result_buf.strides[0] == sizeof(T)
+                ) {
+                    reset();
+                    process_array_no_stride(result_data, x_data, y_data, size);
+                    reset();
+                } else {
+                    process_columns(result_data, result_buf, x_data, x_buf, y_data, y_buf, size, n_threads);
+                }
+            }
+
+            return result;
+        }
+
+        // Process each pair of columns of multidimensional and/or strided
+        // arrays, with n_threads workers that each use their own clone of this
+        // object, see ScreamerBase::run_columns. Runs without the GIL.
+        template <typename T>
+        void process_columns(
+            T* result_data,
+            const py::buffer_info& result_buf,
+            const T* x_data,
+            const py::buffer_info& x_buf,
+            const T* y_data,
+            const py::buffer_info& y_buf,
+            size_t size,
+            int n_threads)
+        {
+            size_t result_stride = result_buf.strides[0] / static_cast<py::ssize_t>(sizeof(T));
+            size_t x_stride = x_buf.strides[0] / static_cast<py::ssize_t>(sizeof(T));
+            size_t y_stride = y_buf.strides[0] / static_cast<py::ssize_t>(sizeof(T));
+
+            ScreamerBase::run_columns(this, x_buf, n_threads, [&](ScreamerBase2* obj, size_t col) {
+                obj->reset();
+                obj->process_array_stride(
+                    result_data + ScreamerBase::column_offset(x_buf, result_buf, col), result_stride,
+                    x_data + ScreamerBase::column_offset(x_buf, x_buf, col), x_stride,
+                    y_data + ScreamerBase::column_offset(x_buf, y_buf, col), y_stride,
+                    size
+                );
+            });
+
+            reset();
+        }
+    };
+
+
+    // CRTP base for operators on two series, like ScreamerKernel. Derived
+    // implements the non-virtual
+    //
+    //     double step(double x, double y)
+    //
+    // and can replace the array loops with its own
+    //
+    //     template <typename T> void array_no_stride(T* r, const T* x, const T* y, size_t size)
+    //     template <typename T> void array_stride(T* r, size_t dr, const T* x, size_t dx, const T* y, size_t dy, size_t size)
+    template <typename Derived>
+    class ScreamerKernel2 : public ScreamerBase2 {
+    public:
+        std::unique_ptr<ScreamerBase2> clone() const override {
+            return std::make_unique<Derived>(static_cast<const Derived&>(*this));
+        }
+
+        double process_scalar(double x, double y) override {
+            return derived().step(x, y);
+        }
+
+        void process_array_no_stride(double* r, const double* x, const double* y, size_t size) override {
+            derived().template array_no_stride<double>(r, x, y, size);
+        }
+
+        void process_array_no_stride(float* r, const float* x, const float* y, size_t size) override {
+            derived().template array_no_stride<float>(r, x, y, size);
+        }
+
+        void process_array_stride(double* r, size_t dr, const double* x, size_t dx, const double* y, size_t dy, size_t size) override {
+            derived().template array_stride<double>(r, dr, x, dx, y, dy, size);
+        }
+
+        void process_array_stride(float* r, size_t dr, const float* x, size_t dx, const float* y, size_t dy, size_t size) override {
+            derived().template array_stride<float>(r, dr, x, dx, y, dy, size);
+        }
+
+        // update() always uses the step loop: array kernels of Derived may assume
+        // they start from a reset state
+        void process_array_update(double* r, size_t dr, const double* x, size_t dx, const double* y, size_t dy, size_t size) override {
+            ScreamerKernel2::array_stride<double>(r, dr, x, dx, y, dy, size);
+        }
+
+        void process_array_update(float* r, size_t dr, const float* x, size_t dx, const float* y, size_t dy, size_t size) override {
+            ScreamerKernel2::array_stride<float>(r, dr, x, dx, y, dy, size);
+        }
+
+        template <typename T>
+        void array_no_stride(T* r, const T* x, const T* y, size_t size) {
+            Derived& d = derived();
+            for (size_t i = 0; i < size; i++) {
+                r[i] = static_cast<T>(d.step(x[i], y[i]));
+            }
+        }
+
+        template <typename T>
+        void array_stride(T* r, size_t dr, const T* x, size_t dx, const T* y, size_t dy, size_t size) {
+            Derived& d = derived();
+            for (size_t i = 0; i < size; i++) {
+                r[i * dr] = static_cast<T>(d.step(x[i * dx], y[i * dy]));
+            }
+        }
+
+    private:
+        Derived& derived() { return static_cast<Derived&>(*this); }
+    };
+
+}
+
+#endif // SCREAMER_BASE2_H
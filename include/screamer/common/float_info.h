@@ -1,6 +1,10 @@
 #ifndef SCREAMER_FLOAT_INFO_H
 #define SCREAMER_FLOAT_INFO_H
 
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+
 /*
 we use -ffast_math, but...
 
@@ -48,6 +52,17 @@ namespace screamer {
     static inline bool isinf2(float a)     { return load_ieee754_rep(a) << 1 == inf_float_shl1; }
     static inline bool isfinite2(float a)  { return load_ieee754_rep(a) << 1  < inf_float_shl1; }
 
+    // True if any value of a strided array is NaN, in one pass without branches
+    template <typename T>
+    bool has_nan(const T* x, size_t dx, size_t size)
+    {
+        size_t count = 0;
+        for (size_t i = 0; i < size; i++) {
+            count += isnan2(x[i * dx]);
+        }
+        return count > 0;
+    }
+
 } // namespace
 
 #endif
\ No newline at end of file
@@ -42,6 +42,21 @@ namespace screamer {
         var = (sum_xx - (sum_x * sum_x) / n) / (n - 1);
     }
 
+    inline void cov_from_stats(double sum_x, double sum_y, double sum_xy, int n, double& cov) {
+        cov = (sum_xy - (sum_x * sum_y) / n) / (n - 1);
+    }
+
+    inline void corr_from_stats(double sum_x, double sum_y, double sum_xy, double sum_xx, double sum_yy, int n, double& corr) {
+        double cxy = sum_xy - (sum_x * sum_y) / n;
+        double cxx = sum_xx - (sum_x * sum_x) / n;
+        double cyy = sum_yy - (sum_y * sum_y) / n;
+        corr = cxy / std::sqrt(cxx * cyy);
+    }
+
+    inline void beta_from_stats(double sum_x, double sum_y, double sum_xy, double sum_xx, int n, double& beta) {
+        beta = (sum_xy - (sum_x * sum_y) / n) / (sum_xx - (sum_x * sum_x) / n);
+    }
+
     inline void skew_n_const(int n_, double& c0) {
         double n = n_;
         c0 = n / ((n - 1) * (n - 2));
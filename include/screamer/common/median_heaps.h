@@ -0,0 +1,230 @@
+#ifndef SCREAMER_MEDIAN_HEAPS_H
+#define SCREAMER_MEDIAN_HEAPS_H
+
+#include <vector>
+#include <limits>
+#include <stdexcept>
+#include <utility>
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include "screamer/common/float_info.h"
+
+namespace screamer {
+
+    // The median of the values in the slots of a ring buffer, kept in two
+    // heaps: a max-heap with the lower half and a min-heap with the upper
+    // half of the values. Every slot remembers its heap and position, so the
+    // value in a slot is replaced in place and sifted, there is no search and
+    // no allocation after construction. Slots holding NaN are in neither heap.
+    class MedianHeaps {
+    public:
+        MedianHeaps(int capacity)
+        {
+            if (capacity <= 0) {
+                throw std::invalid_argument("Capacity must be positive.");
+            }
+            low_.resize(capacity);
+            high_.resize(capacity);
+            heap_.resize(capacity);
+            pos_.resize(capacity);
+            clear();
+        }
+
+        void clear() {
+            std::fill(heap_.begin(), heap_.end(), NONE);
+            low_size_ = 0;
+            high_size_ = 0;
+        }
+
+        int size() const {
+            return low_size_ + high_size_;
+        }
+
+        // Set the value in slot, a NaN value empties the slot
+        void replace(int slot, double value) {
+            bool is_nan = isnan2(value);
+
+            if (heap_[slot] == NONE) {
+                if (!is_nan) {
+                    insert(slot, value);
+                }
+            } else if (is_nan) {
+                erase(slot);
+            } else {
+                update(slot, value);
+            }
+        }
+
+        double median() const {
+            if (low_size_ == 0) {
+                return std::numeric_limits<double>::quiet_NaN();
+            }
+            if (low_size_ == high_size_) {
+                return (low_[0].value + high_[0].value) / 2.0;
+            }
+            return low_[0].value;
+        }
+
+    private:
+        enum : char { NONE, LOW, HIGH };
+
+        struct Node {
+            double value;
+            int slot;
+        };
+
+        std::vector<Node> low_;   // max-heap, the lower half
+        std::vector<Node> high_;  // min-heap, the upper half
+        int low_size_;
+        int high_size_;
+        std::vector<char> heap_;  // heap of the slots
+        std::vector<int> pos_;    // position of the slots in their heap
+
+        // The median is the top of low, which has as many or one more values
+        // than high
+        void insert(int slot, double value) {
+            if (low_size_ == 0 || value <= low_[0].value) {
+                push<LOW>(Node{value, slot});
+            } else {
+                push<HIGH>(Node{value, slot});
+            }
+            rebalance();
+        }
+
+        void erase(int slot) {
+            if (heap_[slot] == LOW) {
+                remove<LOW>(pos_[slot]);
+            } else {
+                remove<HIGH>(pos_[slot]);
+            }
+            heap_[slot] = NONE;
+            rebalance();
+        }
+
+        void update(int slot, double value) {
+            int i = pos_[slot];
+            if (heap_[slot] == LOW) {
+                low_[i].value = value;
+                sift_up<LOW>(i);
+                sift_down<LOW>(pos_[slot]);
+            } else {
+                high_[i].value = value;
+                sift_up<HIGH>(i);
+                sift_down<HIGH>(pos_[slot]);
+            }
+
+            // A single value changed, so at most the two tops are out of order
+            if (high_size_ > 0 && low_[0].value > high_[0].value) {
+                std::swap(low_[0], high_[0]);
+                place<LOW>(0);
+                place<HIGH>(0);
+                sift_down<LOW>(0);
+                sift_down<HIGH>(0);
+            }
+        }
+
+        void rebalance() {
+            if (low_size_ > high_size_ + 1) {
+                Node top = low_[0];
+                remove<LOW>(0);
+                push<HIGH>(top);
+            } else if (high_size_ > low_size_) {
+                Node top = high_[0];
+                remove<HIGH>(0);
+                push<LOW>(top);
+            }
+        }
+
+        template <char H>
+        std::vector<Node>& nodes() {
+            return H == LOW ? low_ : high_;
+        }
+
+        template <char H>
+        int& heap_size() {
+            return H == LOW ? low_size_ : high_size_;
+        }
+
+        // True if a belongs above b in heap H
+        template <char H>
+        static bool above(const Node& a, const Node& b) {
+            return H == LOW ? a.value > b.value : a.value < b.value;
+        }
+
+        // Record the heap and position of the node at i
+        template <char H>
+        void place(int i) {
+            int slot = nodes<H>()[i].slot;
+            heap_[slot] = H;
+            pos_[slot] = i;
+        }
+
+        template <char H>
+        void push(const Node& node) {
+            int i = heap_size<H>()++;
+            nodes<H>()[i] = node;
+            place<H>(i);
+            sift_up<H>(i);
+        }
+
+        // Remove the node at i, the last node takes its place
+        template <char H>
+        void remove(int i) {
+            std::vector<Node>& h = nodes<H>();
+            int last = --heap_size<H>();
+            if (i == last) {
+                return;
+            }
+            h[i] = h[last];
+            int slot = h[i].slot;
+            sift_up<H>(i);
+            sift_down<H>(pos_[slot]);
+        }
+
+        template <char H>
+        void sift_up(int i) {
+            std::vector<Node>& h = nodes<H>();
+            Node node = h[i];
+            while (i > 0) {
+                int parent = (i - 1) / 2;
+                if (!above<H>(node, h[parent])) {
+                    break;
+                }
+                h[i] = h[parent];
+                place<H>(i);
+                i = parent;
+            }
+            h[i] = node;
+            place<H>(i);
+        }
+
+        template <char H>
+        void sift_down(int i) {
+            std::vector<Node>& h = nodes<H>();
+            int n = heap_size<H>();
+            Node node = h[i];
+            while (true) {
+                int child = 2 * i + 1;
+                if (child >= n) {
+                    break;
+                }
+                if (child + 1 < n && above<H>(h[child + 1], h[child])) {
+                    child++;
+                }
+                if (!above<H>(h[child], node)) {
+                    break;
+                }
+                h[i] = h[child];
+                place<H>(i);
+                i = child;
+            }
+            h[i] = node;
+            place<H>(i);
+        }
+
+    };
+
+} // namespace screamer
+
+#endif // SCREAMER_MEDIAN_HEAPS_H
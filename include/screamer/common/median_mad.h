@@ -0,0 +1,139 @@
+#ifndef SCREAMER_MEDIAN_MAD_H
+#define SCREAMER_MEDIAN_MAD_H
+
+#include <vector>
+#include <limits>
+#include <algorithm>
+#include <stdexcept>
+#include "screamer/common/buffer.h"
+#include "screamer/common/sorted_blocks.h"
+#include "screamer/common/float_info.h"
+
+namespace screamer {
+
+    // The median and the median absolute deviation (MAD) of a sliding window.
+    // The window is kept sorted, the distances to the median are then two
+    // sorted sequences: the values below the median, read backwards, and
+    // the values above it. The MAD is selected from both sequences with a
+    // binary search, without computing all distances.
+    class MedianMad {
+    public:
+        MedianMad(int window_size) :
+            window_size(checked_size(window_size)),
+            buffer(window_size, std::numeric_limits<double>::quiet_NaN()),
+            sorted(window_size)
+        {
+            index.build(sorted);
+        }
+
+        void clear() {
+            buffer.reset(std::numeric_limits<double>::quiet_NaN());
+            sorted.clear();
+            index.build(sorted);
+            split = 0;
+        }
+
+        // Add a new value to the window, returns true if the window is full
+        // without NaN
+        bool append(double newValue) {
+            double oldValue = buffer.append(newValue);
+            if (!isnan2(oldValue)) {
+                sorted.erase(oldValue);
+            }
+            if (!isnan2(newValue)) {
+                sorted.insert(newValue);
+            }
+            index.build(sorted);
+            return sorted.size() >= window_size;
+        }
+
+        double median() const {
+            int n = sorted.size();
+            if (n == 0) {
+                return std::numeric_limits<double>::quiet_NaN();
+            }
+            if (n % 2 == 1) {
+                return index[n / 2];
+            }
+            return (index[n / 2 - 1] + index[n / 2]) / 2.0;
+        }
+
+        // The median of the distances of the values to the median m
+        double mad(double m) {
+            int n = sorted.size();
+            if (n == 0) {
+                return std::numeric_limits<double>::quiet_NaN();
+            }
+            int below = sorted.rank(m);
+            int above = n - below;
+
+            // Distances to the median, both increasing
+            auto lower = [&](int i) { return m - index[below - 1 - i]; };
+            auto upper = [&](int j) { return index[below + j] - m; };
+
+            // Split the k + 1 smallest distances in i lower and k + 1 - i
+            // upper distances, the smallest i with upper(k - i) <= lower(i).
+            // The split moves little between steps, so we first walk from the
+            // previous split and fall back to a binary search.
+            int k = (n - 1) / 2;
+            int lo = std::max(0, k + 1 - above);
+            int hi = std::min(k + 1, below);
+            auto too_few = [&](int i) { return upper(k - i) > lower(i); };
+
+            int i = std::max(lo, std::min(split, hi));
+            int walk = 0;
+            if (i < hi && too_few(i)) {
+                do {
+                    i++;
+                    walk++;
+                } while (i < hi && walk < 8 && too_few(i));
+                lo = i;
+            } else {
+                while (i > lo && walk < 8 && !too_few(i - 1)) {
+                    i--;
+                    walk++;
+                }
+                hi = i;
+            }
+            if (walk == 8) {
+                while (lo < hi) {
+                    int mid = (lo + hi) / 2;
+                    if (too_few(mid)) {
+                        lo = mid + 1;
+                    } else {
+                        hi = mid;
+                    }
+                }
+                i = lo;
+            }
+            split = i;
+            int j = k + 1 - i;
+
+            constexpr double inf = std::numeric_limits<double>::infinity();
+            double kth = std::max(i > 0 ? lower(i - 1) : -inf, j > 0 ? upper(j - 1) : -inf);
+            if (n % 2 == 1) {
+                return kth;
+            }
+            double next = std::min(i < below ? lower(i) : inf, j < above ? upper(j) : inf);
+            return (kth + next) / 2.0;
+        }
+
+    private:
+        int window_size;
+        FixedSizeBuffer buffer;
+        SortedBlocks sorted;
+        SortedBlocks::Index index;
+        int split = 0;              // number of lower distances in the last selection
+
+        static int checked_size(int window_size) {
+            if (window_size <= 0) {
+                throw std::invalid_argument("Window size must be positive.");
+            }
+            return window_size;
+        }
+
+    };
+
+} // namespace screamer
+
+#endif // SCREAMER_MEDIAN_MAD_H
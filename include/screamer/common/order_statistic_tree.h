@@ -5,6 +5,7 @@
 #include <vector>
 #include <limits>
 #include <cmath>
+#include <algorithm>
 
 namespace screamer {
 
@@ -87,10 +88,8 @@ namespace screamer {
         }        
 
         void deallocate_node(OSTNode* node) {
-            // Before adding to free list, check if it's already deallocated
-            if (std::find(free_list.begin(), free_list.end(), node) == free_list.end()) {
-                free_list.push_back(node);
-            }
+            // Nodes are deallocated once, when they are unlinked from the tree
+            free_list.push_back(node);
         }        
 
         int get_height(OSTNode* node) const {
@@ -0,0 +1,156 @@
+#ifndef SCREAMER_REGRESSION_H
+#define SCREAMER_REGRESSION_H
+
+#include <pybind11/pybind11.h>
+#include <pybind11/numpy.h>
+#include <string>
+#include <vector>
+#include <stdexcept>
+#include "screamer/common/base.h"
+
+namespace py = pybind11;
+
+namespace screamer {
+
+    // Base class of regressions of y on k factors x. Each step takes a row
+    // of k factor values and the value of y at the same time, and gives the
+    // coefficients, the residual of y or the R-squared of the fit so far.
+    //
+    // With fit_intercept the regression has a constant term, and the
+    // coefficients are the intercept followed by the k factor loadings.
+    class ScreamerRegression {
+    public:
+
+        enum class Output { Coef, Residual, R2 };
+
+        ScreamerRegression(int k, bool fit_intercept, const std::string& output) :
+            k_(k),
+            p_(k + (fit_intercept ? 1 : 0)),
+            fit_intercept_(fit_intercept),
+            output_(parse_output(output))
+        {
+            if (k < 1) {
+                throw std::invalid_argument("The number of factors k must be at least 1.");
+            }
+        }
+
+        virtual ~ScreamerRegression() = default;
+
+        // virtual function with empty default implementation to reset state
+        virtual void reset() {};
+
+        // Number of coefficients, k plus the intercept
+        size_t num_coefs() const { return p_; }
+
+        // Number of results per row: the coefficients, or 1 for the residual
+        // and the R-squared
+        size_t output_size() const { return output_ == Output::Coef ? p_ : 1; }
+
+        // Process one row x of k factor values and the value y, and write the
+        // output_size() results.
+        virtual void process_row(const double* x, double y, double* result) = 0;
+
+        // A row of k factors with a scalar y is one streaming step, and gives
+        // a float, or a tuple of coefficients. A matrix of shape (n, k) with
+        // an array of n values of y is processed from the initial state, like
+        // arrays in ScreamerBase, and gives an array of shape (n,), or (n, p)
+        // for the p coefficients.
+        py::object operator()(py::object x, py::object y) {
+            double value;
+            if (ScreamerBase::scalar_value(y.ptr(), value)) {
+                return row_result(x, value);
+            }
+
+            reset();
+            py::object result = process_rows(x, y);
+            reset();
+            return result;
+        }
+
+        // Process new rows continuing from the current state and keep the
+        // updated state, a single row or a chunk of rows.
+        py::object update(py::object x, py::object y) {
+            double value;
+            if (ScreamerBase::scalar_value(y.ptr(), value)) {
+                return row_result(x, value);
+            }
+            return process_rows(x, y);
+        }
+
+    protected:
+        const int k_;                   // number of factors
+        const int p_;                   // number of coefficients
+        const bool fit_intercept_;
+        const Output output_;
+
+        static Output parse_output(const std::string& output) {
+            if (output == "coef") return Output::Coef;
+            if (output == "residual") return Output::Residual;
+            if (output == "r2") return Output::R2;
+            throw std::invalid_argument("Output must be 'coef', 'residual' or 'r2', got: " + output);
+        }
+
+    private:
+        using row_array = py::array_t<double, py::array::c_style | py::array::forcecast>;
+
+        py::object row_result(py::object x, double y) {
+            row_array x_array = py::cast<row_array>(x);
+            if (x_array.ndim() != 1 || x_array.shape(0) != k_) {
+                throw std::invalid_argument(
+                    "A single row of factors must have shape (k,), with k=" + std::to_string(k_)
+                );
+            }
+
+            std::vector<double> result(output_size());
+            process_row(x_array.data(), y, result.data());
+
+            if (output_ != Output::Coef) {
+                return py::float_(result[0]);
+            }
+            py::tuple values(result.size());
+            for (size_t j = 0; j < result.size(); j++) {
+                values[j] = py::float_(result[j]);
+            }
+            return values;
+        }
+
+        py::object process_rows(py::object x, py::object y) {
+            row_array x_array = py::cast<row_array>(x);
+            row_array y_array = py::cast<row_array>(y);
+
+            if (y_array.ndim() != 1) {
+                throw std::invalid_argument("y must be a scalar or a 1-dimensional array");
+            }
+            size_t n = y_array.shape(0);
+            if (x_array.ndim() != 2 ||
+                static_cast<size_t>(x_array.shape(0)) != n ||
+                x_array.shape(1) != k_
+            ) {
+                throw std::invalid_argument(
+                    "x must have shape (n, k) for n values of y, with k=" + std::to_string(k_)
+                );
+            }
+
+            std::vector<py::ssize_t> shape = {static_cast<py::ssize_t>(n)};
+            if (output_ == Output::Coef) {
+                shape.push_back(p_);
+            }
+            py::array_t<double> result(shape);
+
+            const double* x_data = x_array.data();
+            const double* y_data = y_array.data();
+            double* result_data = result.mutable_data();
+            size_t m = output_size();
+            {
+                py::gil_scoped_release release;
+                for (size_t i = 0; i < n; i++) {
+                    process_row(x_data + i * k_, y_data[i], result_data + i * m);
+                }
+            }
+            return result;
+        }
+    };
+
+} // namespace screamer
+
+#endif // SCREAMER_REGRESSION_H
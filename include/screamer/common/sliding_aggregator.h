@@ -0,0 +1,114 @@
+#ifndef SCREAMER_SLIDING_AGGREGATOR_H
+#define SCREAMER_SLIDING_AGGREGATOR_H
+
+#include <vector>
+#include <stdexcept>
+
+namespace screamer {
+
+    // Aggregate of a sliding window for any associative operation, given at
+    // compile time by a monoid:
+    //
+    //     struct Monoid {
+    //         using value_type = ...;
+    //         static value_type combine(const value_type& older, const value_type& newer);
+    //     };
+    //
+    // The operation doesn't need to be commutative or invertible, combine()
+    // always gets the older values first. Windows are never empty, so no
+    // identity element is needed, which keeps min and max free of infinities.
+    //
+    // This is the two-stacks lite algorithm (Tangwongsan, Hirzel and Schneider,
+    // 2019) on a ring buffer. The newest values are stored as they are, with
+    // their running aggregate. The oldest values are stored as the aggregate
+    // of themselves and all following old values, so the oldest slot holds
+    // the aggregate of all old values. When the old values run out the new
+    // values are turned into old values by one backward pass. The window
+    // aggregate is the combination of both parts, amortized O(1) combines
+    // per value and no allocation after construction.
+    template <typename Monoid>
+    class SlidingAggregator {
+    public:
+        using value_type = typename Monoid::value_type;
+
+        SlidingAggregator(int window_size) :
+            window_size(window_size),
+            slots(window_size)
+        {
+            if (window_size <= 0) {
+                throw std::invalid_argument("Window size must be positive.");
+            }
+            clear();
+        }
+
+        void clear()
+        {
+            first = 0;
+            size = 0;
+            old_size = 0;
+        }
+
+        // Add a value, the oldest value leaves a full window, and return the
+        // aggregate of the window
+        value_type push(const value_type& value)
+        {
+            if (size == window_size) {
+                evict();
+            }
+            int last = first + size;
+            slots[(last >= window_size) ? last - window_size : last] = value;
+            new_aggregate = (size == old_size) ? value : Monoid::combine(new_aggregate, value);
+            size++;
+            return aggregate();
+        }
+
+        value_type aggregate() const
+        {
+            if (old_size == 0) {
+                return new_aggregate;
+            }
+            if (old_size == size) {
+                return slots[first];
+            }
+            return Monoid::combine(slots[first], new_aggregate);
+        }
+
+    private:
+        int window_size;
+        std::vector<value_type> slots;  // ring buffer, old aggregates then new values
+        int first;                      // ring index of the oldest value
+        int size;                       // number of values in the window
+        int old_size;                   // number of old values
+        value_type new_aggregate;       // aggregate of the new values, if any
+
+        void evict()
+        {
+            if (old_size == 0) {
+                flip();
+            }
+            first = (first + 1 == window_size) ? 0 : first + 1;
+            size--;
+            old_size--;
+        }
+
+        // Turn all values into old values, each slot gets the aggregate of
+        // itself and all newer values
+        void flip()
+        {
+            int i = first + size - 1;
+            if (i >= window_size) {
+                i -= window_size;
+            }
+            value_type suffix = slots[i];
+            for (int k = 1; k < size; k++) {
+                i = (i == 0) ? window_size - 1 : i - 1;
+                suffix = Monoid::combine(slots[i], suffix);
+                slots[i] = suffix;
+            }
+            old_size = size;
+        }
+    };
+
+} // namespace screamer
+
+#endif // SCREAMER_SLIDING_AGGREGATOR_H
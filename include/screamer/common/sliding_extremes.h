@@ -0,0 +1,284 @@
+#ifndef SCREAMER_SLIDING_EXTREMES_H
+#define SCREAMER_SLIDING_EXTREMES_H
+
+#include <vector>
+#include <algorithm>
+#include <cstdint>
+#include <cstddef>
+#include <limits>
+#include "screamer/common/float_info.h"
+
+namespace screamer {
+
+    // Orders for the sliding extremes below, keep(a, b) tells if a should
+    // stay the extreme when b arrives later, and at_least(a, b) if a is as
+    // extreme as b
+    struct MaxOrder {
+        static bool keep(double a, double b) { return a > b; }
+        static bool at_least(double a, double b) { return a >= b; }
+        static double pick(double a, double b) { return std::max(a, b); }
+    };
+
+    struct MinOrder {
+        static bool keep(double a, double b) { return a < b; }
+        static bool at_least(double a, double b) { return a <= b; }
+        static double pick(double a, double b) { return std::min(a, b); }
+    };
+
+    // Streaming extreme of a sliding window with a monotonic queue: the
+    // values of the window that can still become the extreme, with the tick
+    // of their arrival. The queue is a ring buffer of window_size + 1 values
+    // allocated once, ticks are 64 bit so long running streams don't wrap.
+    //
+    // Like RollingQuantile and RollingRank, windows with NaN give NaN: NaN
+    // doesn't enter the queue, only the tick of the last NaN is kept.
+    template <typename Order>
+    class MonotonicQueue {
+    public:
+        MonotonicQueue(int window_size) :
+            window_size(window_size),
+            capacity(window_size + 1),
+            values(capacity),
+            ticks(capacity)
+        {
+            clear();
+        }
+
+        void clear()
+        {
+            head = 0;
+            size = 0;
+            tick = 0;
+            nan_tick = -static_cast<int64_t>(window_size);
+        }
+
+        // Add a value and return the extreme of the window that ends with it
+        double push(double value)
+        {
+            if (isnan2(value)) {
+                nan_tick = tick;
+            } else {
+                // Values that are not better than the new value are never the extreme again
+                while (size > 0 && !Order::keep(values[wrap(head + size - 1)], value)) {
+                    size--;
+                }
+                int back = wrap(head + size);
+                values[back] = value;
+                ticks[back] = tick;
+                size++;
+            }
+
+            // Values that left the window, several after a run of NaN
+            while (size > 0 && ticks[head] <= tick - window_size) {
+                head = wrap(head + 1);
+                size--;
+            }
+            tick++;
+            if (has_nan()) {
+                return std::numeric_limits<double>::quiet_NaN();
+            }
+            return values[head];
+        }
+
+        // Number of values that arrived after the extreme, the newest of
+        // equal extremes, NaN if the window has NaN
+        double age() const
+        {
+            if (has_nan()) {
+                return std::numeric_limits<double>::quiet_NaN();
+            }
+            return static_cast<double>(tick - 1 - ticks[head]);
+        }
+
+        // Whether the window that ends with the last value has NaN
+        bool has_nan() const
+        {
+            return nan_tick > tick - 1 - window_size;
+        }
+
+    private:
+        int window_size;
+        int capacity;
+        std::vector<double> values;
+        std::vector<int64_t> ticks;
+        int head;       // ring index of the extreme
+        int size;       // number of values in the queue
+        int64_t tick;   // number of values pushed
+        int64_t nan_tick;   // tick of the last NaN
+
+        int wrap(int i) const
+        {
+            return (i >= capacity) ? i - capacity : i;
+        }
+    };
+
+    // Extremes of the sliding windows of an array with the van Herk /
+    // Gil-Werman algorithm. The array is cut in blocks of window_size values.
+    // The window that ends at offset j of a block is the part of the previous
+    // block after offset j and the part of this block up to offset j: its
+    // extreme is the extreme of a suffix of the previous block and a prefix
+    // of this block. Prefixes and suffixes are running extremes, three
+    // comparisons per value without branches, and the final combination is
+    // a vectorizable loop. Comparisons with NaN make it disagree with the
+    // monotonic queue, arrays with NaN stream instead, see has_nan().
+    template <typename Order>
+    class BlockExtremes {
+    public:
+        BlockExtremes(int window_size) :
+            window_size(window_size),
+            prefix(window_size),
+            suffix(window_size)
+        {
+            clear();
+        }
+
+        void clear()
+        {
+            first = true;
+        }
+
+        // The extremes of the windows that end at the next len values of x,
+        // len is window_size except for the last block. The result is valid
+        // until the next call.
+        template <typename T>
+        const double* next_block(const T* x, size_t dx, int len)
+        {
+            double* p = prefix.data();
+            const double* s = suffix.data();
+
+            double run = static_cast<double>(x[0]);
+            p[0] = run;
+            for (int j = 1; j < len; j++) {
+                run = Order::pick(run, static_cast<double>(x[j * dx]));
+                p[j] = run;
+            }
+
+            // The window that ends at the last offset is this block alone
+            if (!first) {
+                int n = std::min(len, window_size - 1);
+                for (int j = 0; j < n; j++) {
+                    p[j] = Order::pick(s[j + 1], p[j]);
+                }
+            }
+            first = false;
+
+            if (len == window_size) {
+                double* t = suffix.data();
+                run = static_cast<double>(x[(len - 1) * dx]);
+                t[len - 1] = run;
+                for (int j = len - 2; j >= 0; j--) {
+                    run = Order::pick(run, static_cast<double>(x[j * dx]));
+                    t[j] = run;
+                }
+            }
+            return p;
+        }
+
+    private:
+        int window_size;
+        bool first;                     // no previous block, windows are prefixes
+        std::vector<double> prefix;     // running extremes from the block start, then the results
+        std::vector<double> suffix;     // running extremes to the end of the previous block
+    };
+
+    // Extremes of the sliding windows of an array with their age, the number
+    // of values after the extreme in the window, with the van Herk /
+    // Gil-Werman algorithm as in BlockExtremes. The running extremes keep
+    // their position in the block, equal values resolve to the newest.
+    template <typename Order>
+    class BlockArgExtremes {
+    public:
+        BlockArgExtremes(int window_size) :
+            window_size(window_size),
+            prefix(window_size),
+            prefix_at(window_size),
+            suffix(window_size),
+            suffix_at(window_size),
+            age(window_size)
+        {
+            clear();
+        }
+
+        void clear()
+        {
+            first = true;
+        }
+
+        // The extremes of the windows that end at the next len values of x,
+        // len is window_size except for the last block. The results and
+        // ages() are valid until the next call.
+        template <typename T>
+        const double* next_block(const T* x, size_t dx, int len)
+        {
+            double* p = prefix.data();
+            int* pa = prefix_at.data();
+            const double* s = suffix.data();
+            const int* sa = suffix_at.data();
+            int* a = age.data();
+
+            double run = static_cast<double>(x[0]);
+            int at = 0;
+            p[0] = run;
+            pa[0] = 0;
+            for (int j = 1; j < len; j++) {
+                double v = static_cast<double>(x[j * dx]);
+                bool newer = Order::at_least(v, run);
+                run = newer ? v : run;
+                at = newer ? j : at;
+                p[j] = run;
+                pa[j] = at;
+            }
+            for (int j = 0; j < len; j++) {
+                a[j] = j - pa[j];
+            }
+
+            // The suffix of the previous block is older, it wins only if it is
+            // more extreme
+            if (!first) {
+                int n = std::min(len, window_size - 1);
+                for (int j = 0; j < n; j++) {
+                    bool older = Order::keep(s[j + 1], p[j]);
+                    p[j] = older ? s[j + 1] : p[j];
+                    a[j] = older ? window_size + j - sa[j + 1] : a[j];
+                }
+            }
+            first = false;
+
+            if (len == window_size) {
+                double* t = suffix.data();
+                int* ta = suffix_at.data();
+                run = static_cast<double>(x[(len - 1) * dx]);
+                at = len - 1;
+                t[len - 1] = run;
+                ta[len - 1] = at;
+                for (int j = len - 2; j >= 0; j--) {
+                    double v = static_cast<double>(x[j * dx]);
+                    bool older = Order::keep(v, run);
+                    run = older ? v : run;
+                    at = older ? j : at;
+                    t[j] = run;
+                    ta[j] = at;
+                }
+            }
+            return p;
+        }
+
+        // The ages of the extremes of the last block
+        const int* ages() const
+        {
+            return age.data();
+        }
+
+    private:
+        int window_size;
+        bool first;                     // no previous block, windows are prefixes
+        std::vector<double> prefix;     // running extremes from the block start, then the results
+        std::vector<int> prefix_at;     // their offsets in the block
+        std::vector<double> suffix;     // running extremes to the end of the previous block
+        std::vector<int> suffix_at;     // their offsets in the previous block
+        std::vector<int> age;           // ages of the results
+    };
+
+} // namespace screamer
+
+#endif // SCREAMER_SLIDING_EXTREMES_H
@@ -0,0 +1,273 @@
+#ifndef SCREAMER_SORTED_BLOCKS_H
+#define SCREAMER_SORTED_BLOCKS_H
+
+#include <vector>
+#include <stdexcept>
+#include <algorithm>
+#include <cstring>
+#include <cmath>
+
+namespace screamer {
+
+    // Order statistics of a multiset of doubles, stored as a list of sorted
+    // blocks in one contiguous pool. Inserting and erasing shift values inside
+    // a single block, finding a rank scans the block sizes. Both are
+    // O(sqrt(n)) with sequential memory access, which beats the O(log n)
+    // pointer chasing of a balanced tree for the window sizes we use.
+    //
+    // Block slots are recycled, the pool stops growing once it holds the
+    // largest number of blocks needed, so a sliding window that inserts and
+    // erases one value per step doesn't allocate in steady state.
+    class SortedBlocks {
+    public:
+        SortedBlocks(int max_size) :
+            capacity_(block_capacity(max_size)),
+            size_(0)
+        {
+            if (max_size <= 0) {
+                throw std::invalid_argument("Size must be positive.");
+            }
+            // Of two neighbouring blocks at least one is more than a quarter
+            // full, see erase()
+            size_t max_blocks = 8 * static_cast<size_t>(max_size) / capacity_ + 2;
+            pool_.reserve(max_blocks * capacity_);
+            free_.reserve(max_blocks);
+            ids_.reserve(max_blocks);
+            sizes_.reserve(max_blocks);
+            last_.reserve(max_blocks);
+        }
+
+        void insert(double key) {
+            if (ids_.empty()) {
+                ids_.push_back(new_block());
+                sizes_.push_back(0);
+                last_.push_back(key);
+            }
+
+            // The first block that ends with a value >= key, or the last block
+            size_t b = lower_index(last_.data(), last_.size(), key);
+            if (b == ids_.size()) {
+                b--;
+            }
+
+            if (sizes_[b] == capacity_) {
+                split(b);
+                if (key > last_[b]) {
+                    b++;
+                }
+            }
+
+            double* block = data(b);
+            double* end = block + sizes_[b];
+            double* pos = block + upper_index(block, sizes_[b], key);
+            std::memmove(pos + 1, pos, (end - pos) * sizeof(double));
+            *pos = key;
+            sizes_[b]++;
+            last_[b] = block[sizes_[b] - 1];
+            size_++;
+        }
+
+        // Erase one instance of key, keys that are not present are ignored
+        void erase(double key) {
+            size_t b = lower_index(last_.data(), last_.size(), key);
+            if (b == ids_.size()) {
+                return;
+            }
+
+            double* block = data(b);
+            double* end = block + sizes_[b];
+            double* pos = block + lower_index(block, sizes_[b], key);
+            if (*pos != key) {
+                return;
+            }
+            std::memmove(pos, pos + 1, (end - pos - 1) * sizeof(double));
+            sizes_[b]--;
+            size_--;
+
+            if (sizes_[b] == 0) {
+                remove_block(b);
+                return;
+            }
+            last_[b] = block[sizes_[b] - 1];
+
+            // Merge small blocks with a neighbour to keep the number of blocks
+            // proportional to the number of values
+            if (sizes_[b] <= capacity_ / 4) {
+                if (b > 0 && sizes_[b - 1] + sizes_[b] <= capacity_ / 2) {
+                    merge(b - 1);
+                } else if (b + 1 < ids_.size() && sizes_[b] + sizes_[b + 1] <= capacity_ / 2) {
+                    merge(b);
+                }
+            }
+        }
+
+        double kth_element(int k) const {
+            if (k < 0 || k >= size_) {
+                throw std::out_of_range("k is out of bounds");
+            }
+            size_t b = 0;
+            while (k >= sizes_[b]) {
+                k -= sizes_[b];
+                b++;
+            }
+            return pool_[ids_[b] * capacity_ + k];
+        }
+
+        // Number of values smaller than key
+        int rank(double key) const {
+            return count(key, lower_index);
+        }
+
+        // Number of values smaller than or equal to key
+        int upper_rank(double key) const {
+            return count(key, upper_index);
+        }
+
+        int size() const {
+            return size_;
+        }
+
+        // Random access by rank in O(log(number of blocks)) for repeated
+        // lookups, valid until the next insert or erase
+        class Index {
+        public:
+            void build(const SortedBlocks& blocks) {
+                blocks_ = &blocks;
+                starts_.resize(blocks.sizes_.size() + 1);
+                starts_[0] = 0;
+                for (size_t b = 0; b < blocks.sizes_.size(); b++) {
+                    starts_[b + 1] = starts_[b] + blocks.sizes_[b];
+                }
+            }
+
+            double operator[](int k) const {
+                size_t b = std::upper_bound(starts_.begin() + 1, starts_.end() - 1, k) - starts_.begin() - 1;
+                return blocks_->pool_[static_cast<size_t>(blocks_->ids_[b]) * blocks_->capacity_ + k - starts_[b]];
+            }
+
+        private:
+            const SortedBlocks* blocks_ = nullptr;
+            std::vector<int> starts_;   // rank of the first value of the blocks
+        };
+
+        void clear() {
+            ids_.clear();
+            sizes_.clear();
+            last_.clear();
+            free_.clear();
+            pool_.clear();
+            size_ = 0;
+        }
+
+    private:
+        int capacity_;              // values per block
+        int size_;                  // total number of values
+        std::vector<double> pool_;  // block storage, capacity_ values per slot
+        std::vector<int> free_;     // unused slots in the pool
+        std::vector<int> ids_;      // pool slot of the blocks, in sorted order
+        std::vector<int> sizes_;    // number of values in the blocks
+        std::vector<double> last_;  // largest value in the blocks
+
+        // A power of two near 2 sqrt(max_size), within [32, 2048]
+        static int block_capacity(int max_size) {
+            int target = static_cast<int>(2.0 * std::sqrt(std::max(max_size, 1)));
+            int capacity = 32;
+            while (capacity < target && capacity < 2048) {
+                capacity *= 2;
+            }
+            return capacity;
+        }
+
+        // Branch free searches: the comparisons on random data are
+        // unpredictable, so the binary search narrows the range with
+        // arithmetic instead of jumps and the last few values are counted.
+        template <typename Less>
+        static size_t search(const double* values, size_t n, double key, Less less) {
+            const double* base = values;
+            while (n > 16) {
+                size_t half = n / 2;
+                base += less(base[half - 1], key) * half;
+                n -= half;
+            }
+            size_t count = 0;
+            for (size_t i = 0; i < n; i++) {
+                count += less(base[i], key);
+            }
+            return (base - values) + count;
+        }
+
+        // Index of the first value >= key
+        static size_t lower_index(const double* values, size_t n, double key) {
+            return search(values, n, key, [](double a, double b) { return a < b; });
+        }
+
+        // Index of the first value > key
+        static size_t upper_index(const double* values, size_t n, double key) {
+            return search(values, n, key, [](double a, double b) { return a <= b; });
+        }
+
+        // Number of values before the position of key given by index_of
+        template <typename IndexOf>
+        int count(double key, IndexOf index_of) const {
+            size_t b = index_of(last_.data(), last_.size(), key);
+            int count = 0;
+            for (size_t i = 0; i < b; i++) {
+                count += sizes_[i];
+            }
+            if (b < ids_.size()) {
+                count += index_of(pool_.data() + static_cast<size_t>(ids_[b]) * capacity_, sizes_[b], key);
+            }
+            return count;
+        }
+
+        double* data(size_t b) {
+            return pool_.data() + static_cast<size_t>(ids_[b]) * capacity_;
+        }
+
+        int new_block() {
+            if (!free_.empty()) {
+                int id = free_.back();
+                free_.pop_back();
+                return id;
+            }
+            int id = static_cast<int>(pool_.size() / capacity_);
+            pool_.resize(pool_.size() + capacity_);
+            return id;
+        }
+
+        // Move the upper half of the full block b to a new block after it
+        void split(size_t b) {
+            int id = new_block();
+            int half = capacity_ / 2;
+            double* lower = data(b);
+            double* upper = pool_.data() + static_cast<size_t>(id) * capacity_;
+            std::memcpy(upper, lower + half, (capacity_ - half) * sizeof(double));
+
+            double last = last_[b];
+            ids_.insert(ids_.begin() + b + 1, id);
+            sizes_.insert(sizes_.begin() + b + 1, capacity_ - half);
+            last_.insert(last_.begin() + b + 1, last);
+            sizes_[b] = half;
+            last_[b] = lower[half - 1];
+        }
+
+        // Append block b + 1 to block b
+        void merge(size_t b) {
+            std::memcpy(data(b) + sizes_[b], data(b + 1), sizes_[b + 1] * sizeof(double));
+            sizes_[b] += sizes_[b + 1];
+            last_[b] = last_[b + 1];
+            remove_block(b + 1);
+        }
+
+        void remove_block(size_t b) {
+            free_.push_back(ids_[b]);
+            ids_.erase(ids_.begin() + b);
+            sizes_.erase(sizes_.begin() + b);
+            last_.erase(last_.begin() + b);
+        }
+
+    };
+
+} // namespace screamer
+
+#endif // SCREAMER_SORTED_BLOCKS_H
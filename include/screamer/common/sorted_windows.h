@@ -0,0 +1,297 @@
+#ifndef SCREAMER_SORTED_WINDOWS_H
+#define SCREAMER_SORTED_WINDOWS_H
+
+#include <vector>
+#include <algorithm>
+#include <utility>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include "screamer/common/float_info.h"
+
+namespace screamer {
+
+    // Order statistics of all sliding windows of an array, computed offline.
+    //
+    // The array is cut in blocks of window_size values and each block is
+    // sorted once. A window then consists of the tail of one block and the
+    // head of the next. Both are kept as doubly linked lists in sorted order:
+    // moving the window deletes a value from the older list and inserts a
+    // value in the newer list. The newer list is built complete and emptied
+    // backwards first, so the insertions are O(1) undeletions that restore
+    // the links. A pair of cursors, one per list, marks the values below a
+    // rank, and moves by a few positions per window. This is the sliding
+    // window median algorithm of Suomela (2014), O(log(window_size)) per
+    // value for the sort and O(1) for the rest, with sequential memory
+    // access instead of a tree or heap update per value.
+    //
+    // NaN values are not in the lists, count() gives the number of other
+    // values in the window. Windows at the start of the array extend into
+    // NaN values before it, so they hold the values seen so far.
+    class SortedWindows {
+    public:
+        SortedWindows(int window_size) :
+            window_size(window_size),
+            older(window_size),
+            newer(window_size)
+        {}
+
+        // Call result(*this) for each window of x, that ends at x[i], and
+        // store it at y[i]
+        template <typename T, typename Result>
+        void run(T* y, size_t dy, const T* x, size_t dx, size_t size, Result result)
+        {
+            // The block before the array holds only NaN
+            older.clear();
+            a = older.tail();
+            b = Block::head + 1;
+            small = 0;
+
+            for (size_t start = 0; start < size; start += window_size) {
+                int len = static_cast<int>(std::min<size_t>(window_size, size - start));
+                newer.sort(x + start * dx, dx, len);
+                b = newer.tail();
+
+                for (int j = 0; j < len; j++) {
+                    remove(older.node_of[j]);
+                    insert(newer.node_of[j]);
+                    y[(start + j) * dy] = static_cast<T>(result(*this));
+                }
+
+                // The newer block becomes the older, its cursor and the
+                // number of values below it carry over
+                std::swap(older, newer);
+                a = b;
+            }
+        }
+
+        // Number of values in the window
+        int count() const
+        {
+            return older.size + newer.size;
+        }
+
+        // The value at rank k of the window, 0 <= k < count()
+        double kth(int k)
+        {
+            while (small < k) {
+                if (b == newer.tail() || (a != older.tail() && older.value[a] <= newer.value[b])) {
+                    a = older.next[a];
+                } else {
+                    b = newer.next[b];
+                }
+                small++;
+            }
+            while (small > k) {
+                int pa = older.prev[a];
+                int pb = newer.prev[b];
+                if (pa == Block::head || (pb != Block::head && older.value[pa] <= newer.value[pb])) {
+                    b = pb;
+                } else {
+                    a = pa;
+                }
+                small--;
+            }
+            return first(a, b);
+        }
+
+        // The value at rank k + 1 after kth(k), k + 1 < count()
+        double next() const
+        {
+            if (b == newer.tail() || (a != older.tail() && older.value[a] <= newer.value[b])) {
+                return first(older.next[a], b);
+            }
+            return first(a, newer.next[b]);
+        }
+
+    private:
+        // A block of values sorted into a doubly linked list. Nodes are the
+        // sorted values, with sentinels at both ends.
+        struct Block {
+            static constexpr int head = 0;
+
+            int size = 0;                   // number of nodes in the list
+            int nodes = 0;                  // number of non-NaN values in the block
+            std::vector<double> value;      // value of the nodes
+            std::vector<int> next;
+            std::vector<int> prev;
+            std::vector<int> node_of;       // node of the block values, head for NaN
+
+            Block(int window_size) :
+                value(window_size + 2),
+                next(window_size + 2),
+                prev(window_size + 2),
+                node_of(window_size)
+            {
+                items.reserve(window_size);
+            }
+
+            int tail() const
+            {
+                return nodes + 1;
+            }
+
+            // An empty list, for the NaN before the array
+            void clear()
+            {
+                nodes = 0;
+                size = 0;
+                next[head] = tail();
+                prev[tail()] = head;
+                std::fill(node_of.begin(), node_of.end(), head);
+            }
+
+            // Sort len values into the list, then unlink them from last to
+            // first, ready to be relinked in order
+            template <typename T>
+            void sort(const T* x, size_t dx, int len)
+            {
+                items.clear();
+                for (int j = 0; j < len; j++) {
+                    double v = x[j * dx];
+                    if (!isnan2(v)) {
+                        items.push_back(Item{sort_key(v), j});
+                    }
+                }
+                if (items.size() < radix_min_size) {
+                    std::sort(items.begin(), items.end(), [](const Item& p, const Item& q) { return p.key < q.key; });
+                } else {
+                    radix_sort();
+                }
+
+                nodes = static_cast<int>(items.size());
+                std::fill(node_of.begin(), node_of.end(), head);
+                for (int k = 0; k <= nodes + 1; k++) {
+                    next[k] = k + 1;
+                    prev[k] = k - 1;
+                }
+                for (int k = 1; k <= nodes; k++) {
+                    value[k] = key_value(items[k - 1].key);
+                    node_of[items[k - 1].index] = k;
+                }
+
+                for (int j = len - 1; j >= 0; j--) {
+                    int k = node_of[j];
+                    if (k != head) {
+                        next[prev[k]] = next[k];
+                        prev[next[k]] = prev[k];
+                    }
+                }
+                size = 0;
+            }
+
+        private:
+            struct Item {
+                uint64_t key;
+                int index;
+            };
+
+            static constexpr size_t radix_min_size = 256;
+
+            std::vector<Item> items;
+            std::vector<Item> scratch;
+
+            // Unsigned integers in the order of the doubles
+            static uint64_t sort_key(double v)
+            {
+                uint64_t u;
+                std::memcpy(&u, &v, sizeof(u));
+                return (u >> 63) ? ~u : (u | (uint64_t(1) << 63));
+            }
+
+            static double key_value(uint64_t u)
+            {
+                u = (u >> 63) ? (u & ~(uint64_t(1) << 63)) : ~u;
+                double v;
+                std::memcpy(&v, &u, sizeof(v));
+                return v;
+            }
+
+            // Least significant digit first radix sort on bytes, bytes that
+            // are the same for all keys, like most exponent bits, are skipped
+            void radix_sort()
+            {
+                size_t n = items.size();
+                scratch.resize(n);
+                size_t counts[8][256] = {};
+                for (const Item& item : items) {
+                    for (int d = 0; d < 8; d++) {
+                        counts[d][(item.key >> (8 * d)) & 0xff]++;
+                    }
+                }
+                for (int d = 0; d < 8; d++) {
+                    size_t* count = counts[d];
+                    if (count[(items[0].key >> (8 * d)) & 0xff] == n) {
+                        continue;
+                    }
+                    size_t offset = 0;
+                    for (int i = 0; i < 256; i++) {
+                        size_t c = count[i];
+                        count[i] = offset;
+                        offset += c;
+                    }
+                    for (const Item& item : items) {
+                        scratch[count[(item.key >> (8 * d)) & 0xff]++] = item;
+                    }
+                    items.swap(scratch);
+                }
+            }
+        };
+
+        int window_size;
+        Block older;    // the block the window leaves
+        Block newer;    // the block the window enters
+        int a;          // first node of older above the cursor
+        int b;          // first node of newer above the cursor
+        int small;      // number of values below the cursor
+
+        // Values of the older block come first among equal values
+        double first(int na, int nb) const
+        {
+            if (nb == newer.tail() || (na != older.tail() && older.value[na] <= newer.value[nb])) {
+                return older.value[na];
+            }
+            return newer.value[nb];
+        }
+
+        void remove(int k)
+        {
+            if (k == Block::head) {
+                return;
+            }
+            if (k < a) {
+                small--;
+            } else if (k == a) {
+                a = older.next[a];
+            }
+            older.next[older.prev[k]] = older.next[k];
+            older.prev[older.next[k]] = older.prev[k];
+            older.size--;
+        }
+
+        void insert(int k)
+        {
+            if (k == Block::head) {
+                return;
+            }
+            newer.next[newer.prev[k]] = k;
+            newer.prev[newer.next[k]] = k;
+            newer.size++;
+
+            if (k < b) {
+                // The new value is below the cursor, if it is above the
+                // first older value above the cursor they swap sides
+                small++;
+                int pb = newer.prev[b];
+                if (a != older.tail() && older.value[a] <= newer.value[pb]) {
+                    b = pb;
+                    a = older.next[a];
+                }
+            }
+        }
+
+    };
+
+} // namespace screamer
+
+#endif // SCREAMER_SORTED_WINDOWS_H
@@ -15,29 +15,31 @@ namespace py = pybind11;
 namespace screamer {
 
     template <double (*TransformFunc)(double)>
-    class Transform : public ScreamerBase {
+    class Transform : public ScreamerKernel<Transform<TransformFunc>> {
     public:
         Transform() {}
 
-        double process_scalar(double newValue) override {
+        bool supports_inplace() const override { return true; }
+
+        double step(double newValue) {
             return TransformFunc(newValue);
         }
 
-        void process_array_no_stride(double* y, const double* x, size_t size) override {
-            size_t i = 0;
-
+        template <typename T>
+        void array_no_stride(T* y, const T* x, size_t size) {
             for (size_t i=0; i < size; i ++) {
-                y[i] = TransformFunc(x[i]);
+                y[i] = static_cast<T>(TransformFunc(x[i]));
             }
 
         }
 
-        void process_array_stride(double* y, size_t dyi, const double* x, size_t dxi, size_t size) override {
+        template <typename T>
+        void array_stride(T* y, size_t dyi, const T* x, size_t dxi, size_t size) {
             size_t yi = 0;
             size_t xi = 0;
 
             for (size_t i = 0; i < size; i++) {
-                y[yi] = TransformFunc(x[xi]);
+                y[yi] = static_cast<T>(TransformFunc(x[xi]));
                 xi += dxi;
                 yi += dyi;
             }
@@ -0,0 +1,276 @@
+#ifndef SCREAMER_WINDOW_SUMS_H
+#define SCREAMER_WINDOW_SUMS_H
+
+#include <vector>
+#include <algorithm>
+#include <cstddef>
+#include <limits>
+#include "screamer/common/float_info.h"
+
+namespace screamer {
+
+    // The terms x, x^2, ..., x^K of element i of an array, the default terms
+    // of WindowSums
+    template <int K, typename T>
+    struct PowerTerms {
+        const T* x;
+        size_t dx;
+
+        void operator()(size_t i, double* p) const
+        {
+            double value = static_cast<double>(x[i * dx]);
+            double power = 1.0;
+            for (int k = 0; k < K; k++) {
+                power *= value;
+                p[k] = power;
+            }
+        }
+    };
+
+    // The first K of the terms x, y, x * y, x^2, y^2 of element i of two
+    // aligned arrays, for the pairwise statistics
+    template <int K, typename T>
+    struct PairTerms {
+        const T* x;
+        size_t dx;
+        const T* y;
+        size_t dy;
+
+        void operator()(size_t i, double* p) const
+        {
+            double x_value = static_cast<double>(x[i * dx]);
+            double y_value = static_cast<double>(y[i * dy]);
+            double terms[5] = {x_value, y_value, x_value * y_value, x_value * x_value, y_value * y_value};
+            for (int k = 0; k < K; k++) {
+                p[k] = terms[k];
+            }
+        }
+    };
+
+    // Sums of K terms of the elements of the full sliding windows of an
+    // array, by default the powers x, x^2, ..., x^K. A running window sum,
+    // that adds the new value and subtracts the old one, is a serial chain of
+    // additions, and its rounding errors build up along the array. Here the
+    // windows are cut in runs of at most max(window_size, max_run) windows,
+    // each run starts from the sum of its first window, so errors don't build
+    // up past a run. Several runs are summed side by side, which breaks the
+    // chain, and the sums are handed out in tiles, so the statistics computed
+    // from them are vectorizable.
+    template <int K>
+    class WindowSums {
+    public:
+        static constexpr int tile = 64;     // windows per call of result()
+
+        WindowSums(int window_size) :
+            window_size(window_size),
+            buffer(static_cast<size_t>(chains) * K * tile)
+        {}
+
+        // Call result(i, n, sums) for the windows that end at x[i], ...,
+        // x[i + n - 1], n <= tile, where sums[k * tile + t] is the sum of
+        // x^(k + 1) of the window that ends at x[i + t]. Covers all windows
+        // that end at x[window_size - 1] or later, once. Returns true if x
+        // has NaN or inf that went into the sums, a NaN stays in the sum of a
+        // run and an inf stays inf or turns into NaN when it leaves, so this
+        // costs one check per run.
+        template <typename T, typename Result>
+        bool run(const T* x, size_t dx, size_t size, Result result)
+        {
+            return run_terms(PowerTerms<K, T>{x, dx}, size, result);
+        }
+
+        // Like run(), with the sums of other terms of the elements, for
+        // example of the products of two series. terms(i, p) sets p[0], ...,
+        // p[K - 1] to the terms of element i.
+        template <typename Terms, typename Result>
+        bool run_terms(Terms terms, size_t size, Result result)
+        {
+            if (size < static_cast<size_t>(window_size)) {
+                return false;
+            }
+
+            // The first window, the runs then start with the window before
+            // their first window
+            double* b = buffer.data();
+            double p[K];
+            for (int k = 0; k < K; k++) {
+                b[k * tile] = 0.0;
+            }
+            for (int i = 0; i < window_size; i++) {
+                terms(i, p);
+                for (int k = 0; k < K; k++) {
+                    b[k * tile] += p[k];
+                }
+            }
+            result(window_size - 1, 1, b);
+            bool nan = false;
+            for (int k = 0; k < K; k++) {
+                nan |= !isfinite2(b[k * tile]);
+            }
+
+            size_t pos = window_size;
+            size_t windows = size - pos;
+            size_t len = std::max<size_t>(window_size, std::min<size_t>(max_run, windows / chains));
+
+            while (size - pos >= chains * len) {
+                nan |= run_side_by_side<chains>(terms, pos, len, result);
+                pos += chains * len;
+            }
+            while (pos < size) {
+                size_t n = std::min(len, size - pos);
+                nan |= run_side_by_side<1>(terms, pos, n, result);
+                pos += n;
+            }
+            return nan;
+        }
+
+    private:
+        static constexpr int chains = 4;
+        static constexpr size_t max_run = 4096;
+
+        int window_size;
+        std::vector<double> buffer;
+
+        // C runs of len windows, run q ends its first window at
+        // element pos + q * len
+        template <int C, typename Terms, typename Result>
+        bool run_side_by_side(const Terms& terms, size_t pos, size_t len, Result result)
+        {
+            double sum[C][K];
+            double p[K];
+            for (int q = 0; q < C; q++) {
+                size_t end = pos + q * len;
+                for (int k = 0; k < K; k++) {
+                    sum[q][k] = 0.0;
+                }
+                for (size_t i = end - window_size; i < end; i++) {
+                    terms(i, p);
+                    for (int k = 0; k < K; k++) {
+                        sum[q][k] += p[k];
+                    }
+                }
+            }
+
+            // The differences of the terms of the new and the old values are
+            // vectorizable, then the sums of the runs run side by side
+            double* b = buffer.data();
+            for (size_t j0 = 0; j0 < len; j0 += tile) {
+                int n = static_cast<int>(std::min<size_t>(tile, len - j0));
+                for (int q = 0; q < C; q++) {
+                    size_t first = pos + q * len + j0;
+                    double* d = b + q * K * tile;
+                    for (int t = 0; t < n; t++) {
+                        double p_new[K];
+                        double p_old[K];
+                        terms(first + t, p_new);
+                        terms(first + t - window_size, p_old);
+                        for (int k = 0; k < K; k++) {
+                            d[k * tile + t] = p_new[k] - p_old[k];
+                        }
+                    }
+                }
+                for (int t = 0; t < n; t++) {
+                    for (int q = 0; q < C; q++) {
+                        for (int k = 0; k < K; k++) {
+                            double& d = b[(q * K + k) * tile + t];
+                            sum[q][k] += d;
+                            d = sum[q][k];
+                        }
+                    }
+                }
+                for (int q = 0; q < C; q++) {
+                    result(pos + q * len + j0, n, b + q * K * tile);
+                }
+            }
+
+            bool nan = false;
+            for (int q = 0; q < C; q++) {
+                for (int k = 0; k < K; k++) {
+                    nan |= !isfinite2(sum[q][k]);
+                }
+            }
+            return nan;
+        }
+    };
+
+    // Set y to NaN from the first NaN or inf of x on, like the running sums
+    // of the streaming operators that stay NaN after a NaN, and after an inf
+    // that gives inf - inf
+    template <typename T>
+    void fill_nan_from_first_non_finite(T* y, size_t dy, const T* x, size_t dx, size_t size)
+    {
+        size_t i = 0;
+        while (i < size && isfinite2(x[i * dx])) {
+            i++;
+        }
+        for (; i < size; i++) {
+            y[i * dy] = std::numeric_limits<T>::quiet_NaN();
+        }
+    }
+
+    // Set r to NaN from the first NaN or inf of x or y on
+    template <typename T>
+    void fill_nan_from_first_non_finite(T* r, size_t dr, const T* x, size_t dx, const T* y, size_t dy, size_t size)
+    {
+        size_t i = 0;
+        while (i < size && isfinite2(x[i * dx]) && isfinite2(y[i * dy])) {
+            i++;
+        }
+        for (; i < size; i++) {
+            r[i * dr] = std::numeric_limits<T>::quiet_NaN();
+        }
+    }
+
+    // Set y[i] = stat(s, i) for the full windows, where s[k] is the sum of
+    // term k of the window that ends at element i. Returns true if the sums
+    // have NaN or inf, see WindowSums::run().
+    template <int K, typename T, typename Terms, typename Stat>
+    bool window_sums_fill(int window_size, T* y, size_t dy, Terms terms, size_t size, Stat stat)
+    {
+        constexpr int tile = WindowSums<K>::tile;
+        WindowSums<K> sums(window_size);
+        return sums.run_terms(terms, size, [&](size_t i, int count, const double* s) {
+            for (int t = 0; t < count; t++) {
+                double w[K];
+                for (int k = 0; k < K; k++) {
+                    w[k] = s[k * tile + t];
+                }
+                y[(i + t) * dy] = static_cast<T>(stat(w, i + t));
+            }
+        });
+    }
+
+    // The array kernel of a rolling statistic of the powers x, ..., x^K of
+    // the window: the first window_size - 1 values follow the start policy
+    // with derived.step(), the full windows get stat(s, i) of their sums,
+    // and from the first NaN or inf of x on the result is NaN, like the
+    // streaming sums that stay NaN after it.
+    template <int K, typename Derived, typename T, typename Stat>
+    void window_sums_apply(Derived& derived, int window_size, T* y, size_t dy, const T* x, size_t dx, size_t size, Stat stat)
+    {
+        size_t warmup = std::min<size_t>(size, window_size - 1);
+        for (size_t i = 0; i < warmup; i++) {
+            y[i * dy] = static_cast<T>(derived.step(x[i * dx]));
+        }
+        if (window_sums_fill<K>(window_size, y, dy, PowerTerms<K, T>{x, dx}, size, stat)) {
+            fill_nan_from_first_non_finite(y, dy, x, dx, size);
+        }
+    }
+
+    // The same for a rolling statistic of two series, of the first K of the
+    // PairTerms of the window, with derived.step(x, y)
+    template <int K, typename Derived, typename T, typename Stat>
+    void window_sums_apply(Derived& derived, int window_size, T* r, size_t dr, const T* x, size_t dx, const T* y, size_t dy, size_t size, Stat stat)
+    {
+        size_t warmup = std::min<size_t>(size, window_size - 1);
+        for (size_t i = 0; i < warmup; i++) {
+            r[i * dr] = static_cast<T>(derived.step(x[i * dx], y[i * dy]));
+        }
+        if (window_sums_fill<K>(window_size, r, dr, PairTerms<K, T>{x, dx, y, dy}, size, stat)) {
+            fill_nan_from_first_non_finite(r, dr, x, dx, y, dy, size);
+        }
+    }
+
+} // namespace screamer
+
+#endif // SCREAMER_WINDOW_SUMS_H
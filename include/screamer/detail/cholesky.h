@@ -0,0 +1,99 @@
+#ifndef SCREAMER_DETAIL_CHOLESKY_H
+#define SCREAMER_DETAIL_CHOLESKY_H
+
+#include <cmath>
+
+namespace screamer {
+namespace detail {
+
+// Small dense Cholesky helpers for the regressions. L is the p x p lower
+// triangular factor of A = L L', stored column-major, L[i + j * p] is row i
+// and column j. inv_diag keeps the p reciprocals of the diagonal of L, so the
+// updates and solves don't divide. Plain loops are faster than Eigen's
+// dynamic size expressions at the sizes we use, with p up to a few dozen.
+
+// Apply column j of a rank one update (sign 1) or downdate (sign -1) with v.
+// Returns false if the downdated matrix is not positive definite.
+inline bool cholesky_rank_one_column(double* L, double* inv_diag, double* v, int p, int j, double sign) {
+    double* col = L + j * p;
+    double Ljj = col[j];
+    double r2 = Ljj * Ljj + sign * v[j] * v[j];
+    if (!(r2 > 0.0)) {
+        return false;
+    }
+    double r = std::sqrt(r2);
+    double inv_r = 1.0 / r;
+    double c = r * inv_diag[j];
+    double s = v[j] * inv_diag[j];
+    double inv_c = Ljj * inv_r;
+    col[j] = r;
+    inv_diag[j] = inv_r;
+
+    for (int i = j + 1; i < p; i++) {
+        col[i] = (col[i] + sign * s * v[i]) * inv_c;
+        v[i] = c * v[i] - s * col[i];
+    }
+    return true;
+}
+
+// Rank one update of a Cholesky factor in O(p^2): turn L into the factor of
+// A + v v', or of A - v v' for a downdate. v is used as scratch and
+// overwritten.
+//
+// Returns false if the downdated matrix is not positive definite, L is then
+// only partially updated and must be refactored.
+inline bool cholesky_rank_one(double* L, double* inv_diag, double* v, int p, bool downdate) {
+    const double sign = downdate ? -1.0 : 1.0;
+    for (int j = 0; j < p; j++) {
+        if (!cholesky_rank_one_column(L, inv_diag, v, p, j, sign)) {
+            return false;
+        }
+    }
+    return true;
+}
+
+// The factor of A + u u' - w w', the update and downdate of a sliding window.
+// Column j of the downdate only needs column j of the update, so doing both
+// column by column lets their dependency chains of square roots overlap.
+inline bool cholesky_rank_two(double* L, double* inv_diag, double* u, double* w, int p) {
+    for (int j = 0; j < p; j++) {
+        cholesky_rank_one_column(L, inv_diag, u, p, j, 1.0);
+        if (!cholesky_rank_one_column(L, inv_diag, w, p, j, -1.0)) {
+            return false;
+        }
+    }
+    return true;
+}
+
+// Set inv_diag from the diagonal of L, after a new factorization
+inline void cholesky_inv_diag(const double* L, double* inv_diag, int p) {
+    for (int j = 0; j < p; j++) {
+        inv_diag[j] = 1.0 / L[j + j * p];
+    }
+}
+
+// Solve L L' x = b in place in O(p^2), b becomes x
+inline void cholesky_solve(const double* L, const double* inv_diag, double* b, int p) {
+    // forward substitution L z = b, column by column
+    for (int j = 0; j < p; j++) {
+        const double* col = L + j * p;
+        b[j] *= inv_diag[j];
+        for (int i = j + 1; i < p; i++) {
+            b[i] -= col[i] * b[j];
+        }
+    }
+    // backward substitution L' x = z, row j of L' is column j of L
+    for (int j = p - 1; j >= 0; j--) {
+        const double* col = L + j * p;
+        double sum = b[j];
+        for (int i = j + 1; i < p; i++) {
+            sum -= col[i] * b[i];
+        }
+        b[j] = sum * inv_diag[j];
+    }
+}
+
+} // namespace detail
+} // namespace screamer
+
+#endif // SCREAMER_DETAIL_CHOLESKY_H
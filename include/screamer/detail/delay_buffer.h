@@ -63,15 +63,15 @@ public:
         return buffer_[0];
     }        
 
-    const size_t size() {
+    size_t size() const {
         return size_;
     }
 
-    const size_t capacity() {
+    size_t capacity() const {
         return capacity_;
     }
 
-    const StartPolicy start_policy() {
+    StartPolicy start_policy() const {
         return start_policy_;
     }
     
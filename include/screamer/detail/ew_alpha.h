@@ -0,0 +1,47 @@
+#ifndef SCREAMER_DETAIL_EW_ALPHA_H
+#define SCREAMER_DETAIL_EW_ALPHA_H
+
+#include <optional>
+#include <stdexcept>
+#include <cmath>
+
+namespace screamer {
+namespace detail {
+
+// Map exactly one of the com, span, halflife or alpha decay parameters of the
+// exponentially weighted functions to alpha, and validate it.
+inline double ew_alpha(
+    std::optional<double> com,
+    std::optional<double> span,
+    std::optional<double> halflife,
+    std::optional<double> alpha)
+{
+    int provided_args = (com.has_value() ? 1 : 0) +
+                        (span.has_value() ? 1 : 0) +
+                        (halflife.has_value() ? 1 : 0) +
+                        (alpha.has_value() ? 1 : 0);
+
+    if (provided_args != 1) {
+        throw std::invalid_argument("Exactly one of com, span, halflife, or alpha must be provided");
+    }
+
+    double result = 0.0;
+    if (alpha.has_value()) {
+        result = alpha.value();
+    } else if (com.has_value()) {
+        result = 1.0 / (1.0 + com.value());
+    } else if (span.has_value()) {
+        result = 2.0 / (span.value() + 1.0);
+    } else if (halflife.has_value()) {
+        result = 1.0 - std::exp(-std::log(2.0) / halflife.value());
+    }
+
+    if (result <= 0.0 || result >= 1.0) {
+        throw std::invalid_argument("Alpha must be between 0 and 1 (exclusive)");
+    }
+    return result;
+}
+
+} // namespace detail
+} // namespace screamer
+#endif // include guards
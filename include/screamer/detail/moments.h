@@ -0,0 +1,61 @@
+#ifndef SCREAMER_DETAIL_MOMENTS_H
+#define SCREAMER_DETAIL_MOMENTS_H
+
+#include <vector>
+#include <string>
+#include <stdexcept>
+#include <algorithm>
+
+namespace screamer {
+namespace detail {
+
+// The outputs of RollingMoments and EwMoments
+enum class Moment {
+    Mean,
+    Var,
+    Std,
+    Skew,
+    Kurt
+};
+
+inline Moment parse_moment(const std::string& output)
+{
+    if (output == "mean") return Moment::Mean;
+    if (output == "var") return Moment::Var;
+    if (output == "std") return Moment::Std;
+    if (output == "skew") return Moment::Skew;
+    if (output == "kurt") return Moment::Kurt;
+    throw std::invalid_argument("Unknown output: " + output + ", expected mean, var, std, skew or kurt.");
+}
+
+inline std::vector<Moment> parse_moments(const std::vector<std::string>& outputs)
+{
+    if (outputs.empty()) {
+        throw std::invalid_argument("At least one output is required.");
+    }
+    std::vector<Moment> moments;
+    for (const std::string& output : outputs) {
+        moments.push_back(parse_moment(output));
+    }
+    return moments;
+}
+
+// The highest power of the values whose sums are needed for the moments
+inline int moments_power(const std::vector<Moment>& moments)
+{
+    int power = 1;
+    for (Moment moment : moments) {
+        switch (moment) {
+            case Moment::Mean: break;
+            case Moment::Var:
+            case Moment::Std: power = std::max(power, 2); break;
+            case Moment::Skew: power = std::max(power, 3); break;
+            case Moment::Kurt: power = 4; break;
+        }
+    }
+    return power;
+}
+
+} // namespace detail
+} // namespace screamer
+#endif // include guards
@@ -70,15 +70,15 @@ public:
         return sum_;
     }        
 
-    const size_t size() {
+    size_t size() const {
         return size_;
     }
 
-    const size_t capacity() {
+    size_t capacity() const {
         return capacity_;
     }
 
-    const StartPolicy start_policy() {
+    StartPolicy start_policy() const {
         return start_policy_;
     }
 
@@ -0,0 +1,104 @@
+#ifndef SCREAMER_DETAIL_ROLLING_SUM_BANK_H
+#define SCREAMER_DETAIL_ROLLING_SUM_BANK_H
+
+#include <vector>
+#include <limits>
+#include <stdexcept>
+#include <algorithm>
+#include "screamer/detail/start_policy.h"
+
+namespace screamer {
+namespace detail {
+
+// RollingSum of n series that all receive a new value at the same time. The
+// window of the series is a ring buffer of rows, each row holds one value of
+// every series contiguously, and the running sums are a contiguous array.
+class RollingSumBank {
+public:
+    RollingSumBank(size_t n, size_t size, const std::string& start_policy = "strict") 
+        : 
+        n_(n),
+        capacity_(size),
+        start_policy_(parse_start_policy(start_policy)),
+        index_(0),
+        size_(0)
+    {
+        if (size < 1) {
+            throw std::invalid_argument("Size must be at least 1.");
+        }
+
+        buffer_.resize(n * size);
+        sum_.resize(n);
+        reset();
+    }
+
+    void reset() 
+    {
+        size_ = 0;
+        index_ = 0;
+        std::fill(buffer_.begin(), buffer_.end(), 0.0);
+        std::fill(sum_.begin(), sum_.end(), 0.0);
+    }
+
+    // Append the row x with one new value per series, and return the sums of
+    // the windows, or nullptr when they are NaN because of the start policy.
+    const double* append(const double* x) 
+    {
+        double* old_row = buffer_.data() + index_ * n_;
+        double* sum = sum_.data();
+
+        if (size_ == capacity_) {
+            // the most common case, we are past the start period
+            for (size_t c = 0; c < n_; ++c) {
+                sum[c] += x[c] - old_row[c];
+            }
+        } else {
+            for (size_t c = 0; c < n_; ++c) {
+                sum[c] += x[c];
+            }
+            size_++;
+        }
+        std::copy(x, x + n_, old_row);
+
+        index_++;
+        if (index_ == capacity_) {
+            index_ = 0;
+        }
+
+        // if we haven't reached capacity yet the it depends on the policy
+        if ((size_ < capacity_) && (start_policy_ == StartPolicy::Strict)) {
+            return nullptr;
+        }
+        return sum;
+    }
+
+    size_t n() const {
+        return n_;
+    }
+
+    size_t size() const {
+        return size_;
+    }
+
+    size_t capacity() const {
+        return capacity_;
+    }
+
+    StartPolicy start_policy() const {
+        return start_policy_;
+    }
+
+private:
+    const size_t n_;
+    const size_t capacity_;
+    const StartPolicy start_policy_; 
+    size_t index_;
+    size_t size_;
+    std::vector<double> sum_;
+    std::vector<double> buffer_;
+
+}; // class
+
+} // namespace detail
+} // namespace screamer
+#endif // include guards
@@ -11,7 +11,7 @@ namespace py = pybind11;
 
 namespace screamer {
 
-    class Diff : public ScreamerBase {
+    class Diff : public ScreamerKernel<Diff> {
     public:
 
         Diff(int window_size, const std::string& start_policy = "strict") : 
@@ -23,30 +23,32 @@ namespace screamer {
             delay_buffer_.reset();
         }
         
-        double process_scalar(double newValue) override {
+        double step(double newValue) {
 
             return newValue - delay_buffer_.append(newValue);         
         }
 
-        void process_array_no_stride(double* y,  const double* x, size_t size) override {
+        template <typename T>
+        void array_no_stride(T* y,  const T* x, size_t size) {
             size_t window_size_ = delay_buffer_.capacity();
             size_t split = std::min<size_t>(window_size_, size);
 
-            for (int i=0; i < split; ++i) {
-                y[i] = x[i] - delay_buffer_.append(x[i]);
+            for (size_t i=0; i < split; ++i) {
+                y[i] = static_cast<T>(x[i] - delay_buffer_.append(x[i]));
             }
 
-            for (int i=split; i < size; ++i) {
+            for (size_t i=split; i < size; ++i) {
                 y[i] = x[i] - x[i - window_size_];
             }
         }       
 
-        void process_array_stride(double* y, size_t dyi, const double* x, size_t dxi, size_t size) override {
+        template <typename T>
+        void array_stride(T* y, size_t dyi, const T* x, size_t dxi, size_t size) {
             size_t window_size_ = delay_buffer_.capacity();
             size_t split = std::min<size_t>(window_size_, size);
 
             for (size_t i = 0, xi = 0, yi = 0; i < split; ++i, xi += dxi, yi += dyi) {
-                y[yi] = x[xi] - delay_buffer_.append(x[xi]);
+                y[yi] = static_cast<T>(x[xi] - delay_buffer_.append(x[xi]));
             }
 
             size_t shift_x_forward_ = window_size_ * dxi;
@@ -0,0 +1,111 @@
+#ifndef SCREAMER_EW_CORR_H
+#define SCREAMER_EW_CORR_H
+
+#include <optional>
+#include <limits>
+#include <cmath>
+#include <algorithm>
+#include "screamer/common/base2.h"
+#include "screamer/detail/ew_alpha.h"
+
+namespace screamer {
+
+    // Exponentially weighted correlation of two series x and y, the bias
+    // corrections of the covariance and the variances cancel out.
+    class EwCorr : public ScreamerKernel2<EwCorr> {
+    public:
+        explicit EwCorr(
+            std::optional<double> com = std::nullopt,
+            std::optional<double> span = std::nullopt,
+            std::optional<double> halflife = std::nullopt,
+            std::optional<double> alpha = std::nullopt)
+        {
+            alpha_ = detail::ew_alpha(com, span, halflife, alpha);
+            one_minus_alpha_ = 1.0 - alpha_;
+            one_minus_alpha2_ = one_minus_alpha_ * one_minus_alpha_;
+            reset();
+        }
+
+        void reset() override {
+            sums_ = Sums();
+        }
+
+        double step(double x, double y) {
+            sums_.add(x, y, one_minus_alpha_, one_minus_alpha2_);
+            return sums_.corr();
+        }
+
+        // Arrays run the recurrence of the sums, in local variables, for a
+        // tile of values, then compute the correlations of the tile in a
+        // vectorizable loop
+        template <typename T>
+        void array_no_stride(T* r, const T* x, const T* y, size_t size) {
+            array_stride(r, 1, x, 1, y, 1, size);
+        }
+
+        template <typename T>
+        void array_stride(T* r, size_t dr, const T* x, size_t dx, const T* y, size_t dy, size_t size) {
+            constexpr size_t tile = 64;
+            double sx[tile], sy[tile], sxy[tile], sxx[tile], syy[tile], sw[tile], sw2[tile];
+            Sums sums = sums_;
+            for (size_t i0 = 0; i0 < size; i0 += tile) {
+                size_t n = std::min(tile, size - i0);
+                for (size_t t = 0; t < n; t++) {
+                    sums.add(x[(i0 + t) * dx], y[(i0 + t) * dy], one_minus_alpha_, one_minus_alpha2_);
+                    sx[t] = sums.x;
+                    sy[t] = sums.y;
+                    sxy[t] = sums.xy;
+                    sxx[t] = sums.xx;
+                    syy[t] = sums.yy;
+                    sw[t] = sums.w;
+                    sw2[t] = sums.w2;
+                }
+                for (size_t t = 0; t < n; t++) {
+                    r[(i0 + t) * dr] = static_cast<T>(Sums{sx[t], sy[t], sxy[t], sxx[t], syy[t], sw[t], sw2[t]}.corr());
+                }
+            }
+            sums_ = sums;
+        }
+
+    private:
+        // The weighted sums of x, y, x * y, x^2, y^2, the weights and the
+        // squared weights
+        struct Sums {
+            double x = 0.0;
+            double y = 0.0;
+            double xy = 0.0;
+            double xx = 0.0;
+            double yy = 0.0;
+            double w = 0.0;
+            double w2 = 0.0;
+
+            void add(double new_x, double new_y, double one_minus_alpha, double one_minus_alpha2) {
+                x = x * one_minus_alpha + new_x;
+                y = y * one_minus_alpha + new_y;
+                xy = xy * one_minus_alpha + new_x * new_y;
+                xx = xx * one_minus_alpha + new_x * new_x;
+                yy = yy * one_minus_alpha + new_y * new_y;
+                w = w * one_minus_alpha + 1.0;
+                w2 = w2 * one_minus_alpha2 + 1.0;
+            }
+
+            double corr() const {
+                double n_eff = w * w / w2;
+                double mean_x = x / w;
+                double mean_y = y / w;
+                double cov = (xy / w) - (mean_x * mean_y);
+                double var_x = (xx / w) - (mean_x * mean_x);
+                double var_y = (yy / w) - (mean_y * mean_y);
+                return (n_eff <= 1.0) ? std::numeric_limits<double>::quiet_NaN() : cov / std::sqrt(var_x * var_y);
+            }
+        };
+
+        double alpha_;
+        double one_minus_alpha_;
+        double one_minus_alpha2_;
+        Sums sums_;
+    };
+
+} // namespace screamer
+
+#endif // SCREAMER_EW_CORR_H
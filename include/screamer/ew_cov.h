@@ -0,0 +1,103 @@
+#ifndef SCREAMER_EW_COV_H
+#define SCREAMER_EW_COV_H
+
+#include <optional>
+#include <limits>
+#include <cmath>
+#include <algorithm>
+#include "screamer/common/base2.h"
+#include "screamer/detail/ew_alpha.h"
+
+namespace screamer {
+
+    // Exponentially weighted covariance of two series x and y, with the bias
+    // correction of EwVar: EwCov(x, x) is EwVar(x).
+    class EwCov : public ScreamerKernel2<EwCov> {
+    public:
+        explicit EwCov(
+            std::optional<double> com = std::nullopt,
+            std::optional<double> span = std::nullopt,
+            std::optional<double> halflife = std::nullopt,
+            std::optional<double> alpha = std::nullopt)
+        {
+            alpha_ = detail::ew_alpha(com, span, halflife, alpha);
+            one_minus_alpha_ = 1.0 - alpha_;
+            one_minus_alpha2_ = one_minus_alpha_ * one_minus_alpha_;
+            reset();
+        }
+
+        void reset() override {
+            sums_ = Sums();
+        }
+
+        double step(double x, double y) {
+            sums_.add(x, y, one_minus_alpha_, one_minus_alpha2_);
+            return sums_.cov();
+        }
+
+        // Arrays run the recurrence of the sums, in local variables, for a
+        // tile of values, then compute the covariances of the tile in a
+        // vectorizable loop
+        template <typename T>
+        void array_no_stride(T* r, const T* x, const T* y, size_t size) {
+            array_stride(r, 1, x, 1, y, 1, size);
+        }
+
+        template <typename T>
+        void array_stride(T* r, size_t dr, const T* x, size_t dx, const T* y, size_t dy, size_t size) {
+            constexpr size_t tile = 64;
+            double sx[tile], sy[tile], sxy[tile], sw[tile], sw2[tile];
+            Sums sums = sums_;
+            for (size_t i0 = 0; i0 < size; i0 += tile) {
+                size_t n = std::min(tile, size - i0);
+                for (size_t t = 0; t < n; t++) {
+                    sums.add(x[(i0 + t) * dx], y[(i0 + t) * dy], one_minus_alpha_, one_minus_alpha2_);
+                    sx[t] = sums.x;
+                    sy[t] = sums.y;
+                    sxy[t] = sums.xy;
+                    sw[t] = sums.w;
+                    sw2[t] = sums.w2;
+                }
+                for (size_t t = 0; t < n; t++) {
+                    r[(i0 + t) * dr] = static_cast<T>(Sums{sx[t], sy[t], sxy[t], sw[t], sw2[t]}.cov());
+                }
+            }
+            sums_ = sums;
+        }
+
+    private:
+        // The weighted sums of x, y, x * y, the weights and the squared weights
+        struct Sums {
+            double x = 0.0;
+            double y = 0.0;
+            double xy = 0.0;
+            double w = 0.0;
+            double w2 = 0.0;
+
+            void add(double new_x, double new_y, double one_minus_alpha, double one_minus_alpha2) {
+                x = x * one_minus_alpha + new_x;
+                y = y * one_minus_alpha + new_y;
+                xy = xy * one_minus_alpha + new_x * new_y;
+                w = w * one_minus_alpha + 1.0;
+                w2 = w2 * one_minus_alpha2 + 1.0;
+            }
+
+            double cov() const {
+                double n_eff = w * w / w2;
+                double mean_x = x / w;
+                double mean_y = y / w;
+                double cov = (xy / w) - (mean_x * mean_y);
+                cov *= n_eff / (n_eff - 1.0);
+                return (n_eff <= 1.0) ? std::numeric_limits<double>::quiet_NaN() : cov;
+            }
+        };
+
+        double alpha_;
+        double one_minus_alpha_;
+        double one_minus_alpha2_;
+        Sums sums_;
+    };
+
+} // namespace screamer
+
+#endif // SCREAMER_EW_COV_H
@@ -8,7 +8,7 @@
 
 namespace screamer {
 
-    class EwKurt : public ScreamerBase {
+    class EwKurt : public ScreamerKernel<EwKurt> {
     public:
         explicit EwKurt(
             std::optional<double> com = std::nullopt,
@@ -53,7 +53,7 @@ namespace screamer {
             sum_w2_ = 0.0;
         }
 
-        double process_scalar(double newValue) override {
+        double step(double newValue) {
             sum_x_ *= one_minus_alpha_;
             sum_xx_ *= one_minus_alpha_;
             sum_xxx_ *= one_minus_alpha_;
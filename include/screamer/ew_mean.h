@@ -6,10 +6,11 @@
 #include <stdexcept>
 #include <cmath>
 #include "screamer/common/base.h"
+#include "screamer/detail/ew_alpha.h"
 
 namespace screamer {
 
-    class EwMean : public ScreamerBase {
+    class EwMean : public ScreamerKernel<EwMean> {
     public:
         explicit EwMean(
             std::optional<double> com = std::nullopt,
@@ -17,31 +18,7 @@ namespace screamer {
             std::optional<double> halflife = std::nullopt,
             std::optional<double> alpha = std::nullopt)
         {
-            // Count the number of provided arguments
-            int provided_args = (com.has_value() ? 1 : 0) +
-                                (span.has_value() ? 1 : 0) +
-                                (halflife.has_value() ? 1 : 0) +
-                                (alpha.has_value() ? 1 : 0);
-
-            if (provided_args != 1) {
-                throw std::invalid_argument("Exactly one of com, span, halflife, or alpha must be provided");
-            }
-
-            // Map provided argument to alpha
-            if (alpha.has_value()) {
-                alpha_ = alpha.value();
-            } else if (com.has_value()) {
-                alpha_ = 1.0 / (1.0 + com.value());
-            } else if (span.has_value()) {
-                alpha_ = 2.0 / (span.value() + 1.0);
-            } else if (halflife.has_value()) {
-                alpha_ = 1.0 - std::exp(-std::log(2.0) / halflife.value());
-            }
-
-            // Validate alpha
-            if (alpha_ <= 0.0 || alpha_ >= 1.0) {
-                throw std::invalid_argument("Alpha must be between 0 and 1 (exclusive)");
-            }
+            alpha_ = detail::ew_alpha(com, span, halflife, alpha);
             one_minus_alpha_ = 1.0 - alpha_;
 
             reset();
@@ -53,7 +30,7 @@ namespace screamer {
 
         }
 
-        double process_scalar(double newValue) override {
+        double step(double newValue) {
             sum_x_ *= one_minus_alpha_;
             sum_w_ *= one_minus_alpha_;
             sum_x_ += newValue;
@@ -61,7 +38,9 @@ namespace screamer {
             return sum_x_ / sum_w_;  
         }
 
-        void process_array_no_stride(double* y, const double* x, size_t size) override {
+        // Array kernels for double and float values, the sums are always double
+        template <typename T>
+        void array_no_stride(T* y, const T* x, size_t size) {
             double one_minus_alpha_ = this->one_minus_alpha_;
             double sum_x_ = 0.0;
             double sum_w_ = 0.0;
@@ -70,11 +49,12 @@ namespace screamer {
                 sum_w_ *= one_minus_alpha_;
                 sum_x_ += x[i];
                 sum_w_ += 1.0;
-                y[i] = sum_x_ / sum_w_;                  
+                y[i] = static_cast<T>(sum_x_ / sum_w_);                  
             }
         }
 
-        void process_array_stride(double* y, size_t dyi, const double* x, size_t dxi, size_t size) override {
+        template <typename T>
+        void array_stride(T* y, size_t dyi, const T* x, size_t dxi, size_t size) {
             
             double one_minus_alpha_ = this->one_minus_alpha_;
             double sum_x_ = 0.0;
@@ -88,12 +68,53 @@ namespace screamer {
                 sum_w_ *= one_minus_alpha_;
                 sum_x_ += x[xi];
                 sum_w_ += 1.0;
-                y[yi] = sum_x_ / sum_w_;   
+                y[yi] = static_cast<T>(sum_x_ / sum_w_);   
                 xi += dxi;
                 yi += dyi;                
             }
         }  
 
+        bool has_panel_kernel() const override { return true; }
+
+        void process_array_panel(double* y, size_t dy, const double* x, size_t dx, size_t rows, size_t cols) const override {
+            const double one_minus_alpha_ = this->one_minus_alpha_;
+
+            // Per-column weighted sums of one tile of columns, the weights are
+            // the same for all columns
+            std::vector<double> sum_x(panel_tile_cols);
+
+            for (size_t c0 = 0; c0 < cols; c0 += panel_tile_cols) {
+                const size_t nc = std::min(panel_tile_cols, cols - c0);
+                std::fill(sum_x.begin(), sum_x.begin() + nc, 0.0);
+                double* sx = sum_x.data();
+                double sum_w_ = 0.0;
+
+                for (size_t r = 0; r < rows; ++r) {
+                    const double* xr = x + r * dx + c0;
+                    double* yr = y + r * dy + c0;
+
+                    sum_w_ *= one_minus_alpha_;
+                    sum_w_ += 1.0;
+
+                    panel_row(yr, xr, sx, nc, one_minus_alpha_, sum_w_);
+                }
+            }
+        }
+
+        // One row of the panel recurrence, also used by EwMeanBank. Decay the
+        // weighted sums sx of n series, add their new values x and write the means
+        // to y. sum_w is the sum of the weights up to and including this row.
+        static void panel_row(
+            double* y, const double* x, double* sx, size_t n, 
+            double one_minus_alpha, double sum_w) 
+        {
+            for (size_t c = 0; c < n; ++c) {
+                sx[c] *= one_minus_alpha;
+                sx[c] += x[c];
+                y[c] = sx[c] / sum_w;
+            }
+        }
+
     private:
         double alpha_;
         
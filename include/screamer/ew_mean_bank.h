@@ -0,0 +1,51 @@
+#ifndef SCREAMER_EW_MEAN_BANK_H
+#define SCREAMER_EW_MEAN_BANK_H
+
+#include <optional>
+#include <vector>
+#include <algorithm>
+#include "screamer/common/bank.h"
+#include "screamer/detail/ew_alpha.h"
+#include "screamer/ew_mean.h"
+
+namespace screamer {
+
+    // EwMean of n series at once, see ScreamerBank
+    class EwMeanBank : public ScreamerBank {
+    public:
+        explicit EwMeanBank(
+            int n,
+            std::optional<double> com = std::nullopt,
+            std::optional<double> span = std::nullopt,
+            std::optional<double> halflife = std::nullopt,
+            std::optional<double> alpha = std::nullopt)
+            : 
+            ScreamerBank(n),
+            alpha_(detail::ew_alpha(com, span, halflife, alpha)),
+            one_minus_alpha_(1.0 - alpha_),
+            sum_x_(n)
+        {
+            reset();
+        }
+
+        void reset() override {
+            std::fill(sum_x_.begin(), sum_x_.end(), 0.0);
+            sum_w_ = 0.0;
+        }
+
+        void process_row(double* y, const double* x) override {
+            sum_w_ *= one_minus_alpha_;
+            sum_w_ += 1.0;
+            EwMean::panel_row(y, x, sum_x_.data(), n_, one_minus_alpha_, sum_w_);
+        }
+
+    private:
+        double alpha_;
+        double one_minus_alpha_;
+        std::vector<double> sum_x_;
+        double sum_w_;
+    };
+
+} // namespace screamer
+
+#endif // SCREAMER_EW_MEAN_BANK_H
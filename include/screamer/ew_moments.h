@@ -0,0 +1,126 @@
+#ifndef SCREAMER_EW_MOMENTS_H
+#define SCREAMER_EW_MOMENTS_H
+
+#include <optional>
+#include <vector>
+#include <string>
+#include <limits>
+#include <cmath>
+#include <algorithm>
+#include "screamer/common/base.h"
+#include "screamer/detail/ew_alpha.h"
+#include "screamer/detail/moments.h"
+
+namespace screamer {
+
+    // Several exponentially weighted moments of the same series: mean, var,
+    // std, skew and kurt, in the order of outputs. The weighted power sums are
+    // decayed and updated once per value, only up to the highest power the
+    // outputs need. The values are those of EwMean, EwVar, EwStd, EwSkew and
+    // EwKurt with the same decay.
+    class EwMoments : public ScreamerKernel<EwMoments> {
+    public:
+        explicit EwMoments(
+            const std::vector<std::string>& outputs = {"mean", "std", "skew", "kurt"},
+            std::optional<double> com = std::nullopt,
+            std::optional<double> span = std::nullopt,
+            std::optional<double> halflife = std::nullopt,
+            std::optional<double> alpha = std::nullopt
+        ) :
+            moments_(detail::parse_moments(outputs)),
+            power_(detail::moments_power(moments_)),
+            results_(moments_.size())
+        {
+            alpha_ = detail::ew_alpha(com, span, halflife, alpha);
+            one_minus_alpha_ = 1.0 - alpha_;
+            one_minus_alpha2_ = one_minus_alpha_ * one_minus_alpha_;
+            reset();
+        }
+
+        void reset() override {
+            std::fill(sums_, sums_ + 4, 0.0);
+            sum_w_ = 0.0;
+            sum_w2_ = 0.0;
+        }
+
+        size_t output_size() const override {
+            return moments_.size();
+        }
+
+        double step(double newValue) {
+            process_scalar_multi(newValue, results_.data());
+            return results_[0];
+        }
+
+        void process_scalar_multi(double newValue, double* results) override {
+            double newValue2 = newValue * newValue;
+            double p[4] = {newValue, newValue2, newValue2 * newValue, newValue2 * newValue * newValue};
+            for (int k = 0; k < power_; k++) {
+                sums_[k] *= one_minus_alpha_;
+                sums_[k] += p[k];
+            }
+            sum_w_ *= one_minus_alpha_;
+            sum_w2_ *= one_minus_alpha2_;
+            sum_w_ += 1.0;
+            sum_w2_ += 1.0;
+
+            // The moments with the effective sample size n_eff for the bias
+            // corrections, see ew_var.h. The mean and variance are shared.
+            const double nan = std::numeric_limits<double>::quiet_NaN();
+            double n_eff = sum_w_ * sum_w_ / sum_w2_;
+            double mean = sums_[0] / sum_w_;
+            double mean2 = mean * mean;
+            double variance = 0.0;
+            if (power_ >= 2) {
+                variance = (sums_[1] / sum_w_) - mean2;
+                variance *= n_eff / (n_eff - 1.0);
+            }
+
+            for (size_t j = 0; j < moments_.size(); j++) {
+                switch (moments_[j]) {
+                    case detail::Moment::Mean:
+                        results[j] = mean;
+                        break;
+                    case detail::Moment::Var:
+                        results[j] = (n_eff <= 1.0) ? nan : variance;
+                        break;
+                    case detail::Moment::Std:
+                        results[j] = (n_eff <= 1.0) ? nan : std::sqrt(variance);
+                        break;
+                    case detail::Moment::Skew: {
+                        double std_dev = std::sqrt(variance);
+                        double m3 = (sums_[2] / sum_w_) - 3 * mean * (sums_[1] / sum_w_) + 2 * mean * mean * mean;
+                        double g1 = m3 / (std_dev * std_dev * std_dev);
+                        double skew = (n_eff * g1) / ((n_eff - 1.0) * (n_eff - 2.0));
+                        results[j] = (n_eff <= 2.0) ? nan : skew;
+                        break;
+                    }
+                    case detail::Moment::Kurt: {
+                        double m4 = (sums_[3] / sum_w_) - 4 * mean * (sums_[2] / sum_w_) +
+                                    6 * mean2 * (sums_[1] / sum_w_) - 3 * mean2 * mean2;
+                        double g2 = m4 / (variance * variance);
+                        double excess_kurtosis = ((n_eff * (n_eff + 1) * g2 - 3 * (n_eff - 1) * (n_eff - 1)) /
+                                                  ((n_eff - 1) * (n_eff - 2) * (n_eff - 3)));
+                        results[j] = (n_eff <= 3.0) ? nan : excess_kurtosis;
+                        break;
+                    }
+                }
+            }
+        }
+
+    private:
+        const std::vector<detail::Moment> moments_;
+        const int power_;                   // highest power in sums_
+        std::vector<double> results_;       // scratch for step()
+
+        double alpha_;
+        double one_minus_alpha_;
+        double one_minus_alpha2_;
+        double sums_[4];                    // weighted sums of x, x^2, x^3 and x^4
+        double sum_w_;
+        double sum_w2_;
+    };
+
+} // namespace screamer
+
+#endif // SCREAMER_EW_MOMENTS_H
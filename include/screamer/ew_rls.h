@@ -0,0 +1,189 @@
+#ifndef SCREAMER_EW_RLS_H
+#define SCREAMER_EW_RLS_H
+
+#include <optional>
+#include <vector>
+#include <string>
+#include <limits>
+#include <cmath>
+#include <algorithm>
+#include <Eigen/Dense>
+#include "screamer/common/regression.h"
+#include "screamer/common/float_info.h"
+#include "screamer/detail/cholesky.h"
+#include "screamer/detail/ew_alpha.h"
+
+namespace screamer {
+
+    // Exponentially weighted recursive least squares regression of y on k
+    // factors: the fit that minimizes the sum of the squared residuals with
+    // weights (1 - alpha)^age, the EW counterpart of RollingOLS.
+    //
+    // Each row decays the weighted X'X by lambda = 1 - alpha and adds the new
+    // row. Its Cholesky factor L is kept along: L is scaled by sqrt(lambda)
+    // and gets a rank one update with the new row, so a step costs O(p^2)
+    // for p coefficients and allocates nothing. This square root form stays
+    // positive definite, unlike the update of the inverse of X'X in the
+    // classic RLS recursion, and needs no prior for the first rows: the
+    // result is NaN until the rows so far determine the coefficients.
+    //
+    // Rows with a NaN in x or y are skipped, they leave the state unchanged
+    // and give NaN.
+    class EwRLS : public ScreamerRegression {
+    public:
+
+        EwRLS(
+            int k,
+            std::optional<double> com = std::nullopt,
+            std::optional<double> span = std::nullopt,
+            std::optional<double> halflife = std::nullopt,
+            std::optional<double> alpha = std::nullopt,
+            const std::string& output = "coef",
+            bool fit_intercept = true
+        ) :
+            ScreamerRegression(k, fit_intercept, output),
+            llt_(p_)
+        {
+            alpha_ = detail::ew_alpha(com, span, halflife, alpha);
+            lambda_ = 1.0 - alpha_;
+            sqrt_lambda_ = std::sqrt(lambda_);
+            inv_sqrt_lambda_ = 1.0 / sqrt_lambda_;
+
+            row_.resize(p_);
+            xtx_.resize(p_ * p_);
+            xty_.resize(p_);
+            L_.resize(p_ * p_);
+            inv_diag_.resize(p_);
+            u_.resize(p_);
+            beta_.resize(p_);
+            reset();
+        }
+
+        void reset() override {
+            std::fill(xtx_.begin(), xtx_.end(), 0.0);
+            std::fill(xty_.begin(), xty_.end(), 0.0);
+            sum_w_ = 0.0;
+            sum_y_ = 0.0;
+            sum_yy_ = 0.0;
+            count_ = 0;
+            factor_ok_ = false;
+        }
+
+        void process_row(const double* x, double y, double* result) override {
+            // the new row, with a leading 1 for the intercept
+            int offset = fit_intercept_ ? 1 : 0;
+            if (fit_intercept_) {
+                row_[0] = 1.0;
+            }
+            bool valid = isfinite2(y);
+            for (int j = 0; j < k_; j++) {
+                row_[offset + j] = x[j];
+                valid = valid && isfinite2(x[j]);
+            }
+
+            if (!valid || !add(y) || !solve()) {
+                std::fill(result, result + output_size(), std::numeric_limits<double>::quiet_NaN());
+                return;
+            }
+
+            switch (output_) {
+                case Output::Coef:
+                    std::copy(beta_.begin(), beta_.end(), result);
+                    break;
+                case Output::Residual:
+                    result[0] = y - dot(row_.data(), beta_.data());
+                    break;
+                case Output::R2: {
+                    double ssr = sum_yy_ - dot(beta_.data(), xty_.data());
+                    double sst = fit_intercept_ ? sum_yy_ - sum_y_ * sum_y_ / sum_w_ : sum_yy_;
+                    result[0] = 1.0 - ssr / sst;
+                    break;
+                }
+            }
+        }
+
+    private:
+        double alpha_;
+        double lambda_;                     // forgetting factor 1 - alpha
+        double sqrt_lambda_;
+        double inv_sqrt_lambda_;
+
+        std::vector<double> row_;           // the new row, p values
+        int count_;                         // number of valid rows, up to p_
+
+        std::vector<double> xtx_;           // weighted X'X, lower triangle, column-major
+        std::vector<double> xty_;           // weighted X'y
+        double sum_w_;
+        double sum_y_;
+        double sum_yy_;
+
+        Eigen::LLT<Eigen::MatrixXd> llt_;   // for factoring X'X
+        std::vector<double> L_;             // Cholesky factor of X'X, see detail/cholesky.h
+        std::vector<double> inv_diag_;      // reciprocals of the diagonal of L_
+        bool factor_ok_;                    // whether L_ is the factor of xtx_
+        std::vector<double> u_;             // scratch for the rank one update
+        std::vector<double> beta_;          // coefficients
+
+        double dot(const double* a, const double* b) const {
+            double sum = 0.0;
+            for (int j = 0; j < p_; j++) {
+                sum += a[j] * b[j];
+            }
+            return sum;
+        }
+
+        // Decay the sums and add the new row, and update the factor. Returns
+        // false if there are fewer rows than coefficients.
+        bool add(double y) {
+            const double* row = row_.data();
+            for (int j = 0; j < p_; j++) {
+                double* col = &xtx_[j * p_];
+                for (int i = j; i < p_; i++) {
+                    col[i] = lambda_ * col[i] + row[j] * row[i];
+                }
+                xty_[j] = lambda_ * xty_[j] + row[j] * y;
+            }
+            sum_w_ = lambda_ * sum_w_ + 1.0;
+            sum_y_ = lambda_ * sum_y_ + y;
+            sum_yy_ = lambda_ * sum_yy_ + y * y;
+            if (count_ < p_) {
+                count_++;
+            }
+
+            if (factor_ok_) {
+                for (int j = 0; j < p_; j++) {
+                    double* col = &L_[j * p_];
+                    for (int i = j; i < p_; i++) {
+                        col[i] *= sqrt_lambda_;
+                    }
+                    inv_diag_[j] *= inv_sqrt_lambda_;
+                }
+                std::copy(row_.begin(), row_.end(), u_.begin());
+                factor_ok_ = detail::cholesky_rank_one(L_.data(), inv_diag_.data(), u_.data(), p_, false);
+            }
+            return count_ == p_;
+        }
+
+        // Solve X'X beta = X'y with the Cholesky factor, factoring X'X first
+        // if needed. Returns false if X'X is singular.
+        bool solve() {
+            if (!factor_ok_) {
+                // LLT only reads the lower triangle
+                llt_.compute(Eigen::Map<const Eigen::MatrixXd>(xtx_.data(), p_, p_));
+                if (llt_.info() != Eigen::Success) {
+                    return false;
+                }
+                Eigen::Map<Eigen::MatrixXd>(L_.data(), p_, p_) = llt_.matrixL();
+                detail::cholesky_inv_diag(L_.data(), inv_diag_.data(), p_);
+                factor_ok_ = true;
+            }
+            std::copy(xty_.begin(), xty_.end(), beta_.begin());
+            detail::cholesky_solve(L_.data(), inv_diag_.data(), beta_.data(), p_);
+            return true;
+        }
+
+    }; // end of class
+
+} // end of namespace
+
+#endif // SCREAMER_EW_RLS_H
@@ -10,7 +10,7 @@
 
 namespace screamer {
 
-    class EwRms : public ScreamerBase {
+    class EwRms : public ScreamerKernel<EwRms> {
     public:
         explicit EwRms(
             std::optional<double> com = std::nullopt,
@@ -53,7 +53,7 @@ namespace screamer {
             sum_w_ = 0.0;
         }
 
-        double process_scalar(double newValue) override {
+        double step(double newValue) {
             sum_xx_ *= one_minus_alpha_;
             sum_w_ *= one_minus_alpha_;
 
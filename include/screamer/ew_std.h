@@ -6,11 +6,12 @@
 #include <stdexcept>
 #include <cmath>
 #include "screamer/common/base.h"
+#include "screamer/detail/ew_alpha.h"
 
 
 namespace screamer {
 
-    class EwStd : public ScreamerBase {
+    class EwStd : public ScreamerKernel<EwStd> {
     public:
         explicit EwStd(
             std::optional<double> com = std::nullopt,
@@ -18,31 +19,7 @@ namespace screamer {
             std::optional<double> halflife = std::nullopt,
             std::optional<double> alpha = std::nullopt)
         {
-            // Count the number of provided arguments
-            int provided_args = (com.has_value() ? 1 : 0) +
-                                (span.has_value() ? 1 : 0) +
-                                (halflife.has_value() ? 1 : 0) +
-                                (alpha.has_value() ? 1 : 0);
-
-            if (provided_args != 1) {
-                throw std::invalid_argument("Exactly one of com, span, halflife, or alpha must be provided");
-            }
-
-            // Map provided argument to alpha
-            if (alpha.has_value()) {
-                alpha_ = alpha.value();
-            } else if (com.has_value()) {
-                alpha_ = 1.0 / (1.0 + com.value());
-            } else if (span.has_value()) {
-                alpha_ = 2.0 / (span.value() + 1.0);
-            } else if (halflife.has_value()) {
-                alpha_ = 1.0 - std::exp(-std::log(2.0) / halflife.value());
-            }
-
-            // Validate alpha
-            if (alpha_ <= 0.0 || alpha_ >= 1.0) {
-                throw std::invalid_argument("Alpha must be between 0 and 1 (exclusive)");
-            }
+            alpha_ = detail::ew_alpha(com, span, halflife, alpha);
             one_minus_alpha_ = 1.0 - alpha_;
             one_minus_alpha2_ = one_minus_alpha_*one_minus_alpha_;
 
@@ -56,7 +33,7 @@ namespace screamer {
             sum_w2_ = 0.0;
         }
 
-        double process_scalar(double newValue) override {
+        double step(double newValue) {
             sum_x_ *= one_minus_alpha_;
             sum_xx_ *= one_minus_alpha_;
 
@@ -84,75 +61,67 @@ namespace screamer {
             }            
         }
 
-        void process_array_no_stride(double* y, const double* x, size_t size) override {
-            double one_minus_alpha_ = this->one_minus_alpha_;
-            double sum_x_ = 0.0;
-            double sum_xx_ = 0.0;
-            double sum_w_ = 0.0;
-            double sum_w2_ = 0.0;
-
-            for (size_t i=0; i<size; i++) {
-                sum_x_ *= one_minus_alpha_;
-                sum_xx_ *= one_minus_alpha_;
-
-                sum_w_ *= one_minus_alpha_;
-                sum_w2_ *= one_minus_alpha2_;
-
-                sum_x_ += x[i];
-                sum_xx_ += x[i] * x[i];
-
-                sum_w_ += 1.0;
-                sum_w2_ += 1.0;
-                
-                double n_eff = sum_w_ * sum_w_ / sum_w2_; 
-                double mean = sum_x_ / sum_w_;
-                double variance = (sum_xx_ / sum_w_) - (mean * mean);
-                variance *= n_eff / (n_eff - 1.0);
-                if (n_eff <= 1.0) {
-                    y[i] = std::numeric_limits<double>::quiet_NaN();
-                } else {
-                    y[i] = std::sqrt(variance);
-                }                
+        bool has_panel_kernel() const override { return true; }
+
+        void process_array_panel(double* y, size_t dy, const double* x, size_t dx, size_t rows, size_t cols) const override {
+            const double one_minus_alpha_ = this->one_minus_alpha_;
+            const double one_minus_alpha2_ = this->one_minus_alpha2_;
+
+            // Per-column weighted sums of one tile of columns, the weights are
+            // the same for all columns
+            std::vector<double> sum_x(panel_tile_cols);
+            std::vector<double> sum_xx(panel_tile_cols);
+
+            for (size_t c0 = 0; c0 < cols; c0 += panel_tile_cols) {
+                const size_t nc = std::min(panel_tile_cols, cols - c0);
+                std::fill(sum_x.begin(), sum_x.begin() + nc, 0.0);
+                std::fill(sum_xx.begin(), sum_xx.begin() + nc, 0.0);
+                double* sx = sum_x.data();
+                double* sxx = sum_xx.data();
+                double sum_w_ = 0.0;
+                double sum_w2_ = 0.0;
+
+                for (size_t r = 0; r < rows; ++r) {
+                    const double* xr = x + r * dx + c0;
+                    double* yr = y + r * dy + c0;
+
+                    sum_w_ *= one_minus_alpha_;
+                    sum_w2_ *= one_minus_alpha2_;
+                    sum_w_ += 1.0;
+                    sum_w2_ += 1.0;
+
+                    panel_row(yr, xr, sx, sxx, nc, one_minus_alpha_, sum_w_, sum_w2_);
+                }
             }
         }
 
-        void process_array_stride(double* y, size_t dyi, const double* x, size_t dxi, size_t size) override {
-            
-            double one_minus_alpha_ = this->one_minus_alpha_;
-            double sum_x_ = 0.0;
-            double sum_xx_ = 0.0;
-            double sum_w_ = 0.0;
-            double sum_w2_ = 0.0;
-            
-            size_t xi = 0;
-            size_t yi = 0;
-
-            for (size_t i=0; i<size; i++) { // start at 1
-                sum_x_ *= one_minus_alpha_;
-                sum_xx_ *= one_minus_alpha_;
-
-                sum_w_ *= one_minus_alpha_;
-                sum_w2_ *= one_minus_alpha2_;
-
-                sum_x_ += x[xi];
-                sum_xx_ += x[xi]*x[xi];
-
-                sum_w_ += 1.0;
-                sum_w2_ += 1.0;
-
-                double n_eff = sum_w_* sum_w_ / sum_w2_; 
-                double mean = sum_x_ / sum_w_;
-                double variance = (sum_xx_ / sum_w_) - (mean * mean);
-                variance *= n_eff / (n_eff - 1.0);
-                if (n_eff <= 1.0) {
-                    y[yi] = std::numeric_limits<double>::quiet_NaN();
-                } else {
-                    y[yi] = std::sqrt(variance);
-                }                
-                xi += dxi;
-                yi += dyi;                
+        // One row of the panel recurrence, also used by EwStdBank. Decay the weighted
+        // sums sx and sxx of n series, add their new values x and write the standard deviations
+        // to y. sum_w and sum_w2 are the sums of the weights and squared weights up to
+        // and including this row.
+        static void panel_row(
+            double* y, const double* x, double* sx, double* sxx, size_t n, 
+            double one_minus_alpha, double sum_w, double sum_w2) 
+        {
+            double n_eff = sum_w * sum_w / sum_w2;
+            double bias = n_eff / (n_eff - 1.0);
+
+            for (size_t c = 0; c < n; ++c) {
+                sx[c] *= one_minus_alpha;
+                sxx[c] *= one_minus_alpha;
+                sx[c] += x[c];
+                sxx[c] += x[c] * x[c];
+
+                double mean = sx[c] / sum_w;
+                double variance = (sxx[c] / sum_w) - (mean * mean);
+                variance *= bias;
+                y[c] = std::sqrt(variance);
             }
-        }  
+
+            if (n_eff <= 1.0) {
+                std::fill(y, y + n, std::numeric_limits<double>::quiet_NaN());
+            }
+        }
 
     private:
         double alpha_;
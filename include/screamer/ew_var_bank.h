@@ -0,0 +1,60 @@
+#ifndef SCREAMER_EW_VAR_BANK_H
+#define SCREAMER_EW_VAR_BANK_H
+
+#include <optional>
+#include <vector>
+#include <algorithm>
+#include "screamer/common/bank.h"
+#include "screamer/detail/ew_alpha.h"
+#include "screamer/ew_var.h"
+
+namespace screamer {
+
+    // EwVar of n series at once, see ScreamerBank
+    class EwVarBank : public ScreamerBank {
+    public:
+        explicit EwVarBank(
+            int n,
+            std::optional<double> com = std::nullopt,
+            std::optional<double> span = std::nullopt,
+            std::optional<double> halflife = std::nullopt,
+            std::optional<double> alpha = std::nullopt)
+            : 
+            ScreamerBank(n),
+            alpha_(detail::ew_alpha(com, span, halflife, alpha)),
+            one_minus_alpha_(1.0 - alpha_),
+            one_minus_alpha2_(one_minus_alpha_ * one_minus_alpha_),
+            sum_x_(n),
+            sum_xx_(n)
+        {
+            reset();
+        }
+
+        void reset() override {
+            std::fill(sum_x_.begin(), sum_x_.end(), 0.0);
+            std::fill(sum_xx_.begin(), sum_xx_.end(), 0.0);
+            sum_w_ = 0.0;
+            sum_w2_ = 0.0;
+        }
+
+        void process_row(double* y, const double* x) override {
+            sum_w_ *= one_minus_alpha_;
+            sum_w2_ *= one_minus_alpha2_;
+            sum_w_ += 1.0;
+            sum_w2_ += 1.0;
+            EwVar::panel_row(y, x, sum_x_.data(), sum_xx_.data(), n_, one_minus_alpha_, sum_w_, sum_w2_);
+        }
+
+    private:
+        double alpha_;
+        double one_minus_alpha_;
+        double one_minus_alpha2_;
+        std::vector<double> sum_x_;
+        std::vector<double> sum_xx_;
+        double sum_w_;
+        double sum_w2_;
+    };
+
+} // namespace screamer
+
+#endif // SCREAMER_EW_VAR_BANK_H
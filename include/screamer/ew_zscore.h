@@ -10,7 +10,7 @@
 
 namespace screamer {
 
-    class EwZscore : public ScreamerBase {
+    class EwZscore : public ScreamerKernel<EwZscore> {
     public:
         explicit EwZscore(
             std::optional<double> com = std::nullopt,
@@ -56,7 +56,7 @@ namespace screamer {
             sum_w2_ = 0.0;
         }
 
-        double process_scalar(double newValue) override {
+        double step(double newValue) {
             sum_x_ *= one_minus_alpha_;
             sum_xx_ *= one_minus_alpha_;
 
@@ -11,7 +11,7 @@ namespace py = pybind11;
 
 namespace screamer {
 
-    class Ffill : public ScreamerBase {
+    class Ffill : public ScreamerKernel<Ffill> {
     public:
 
         Ffill() : lastValidValue(std::numeric_limits<double>::quiet_NaN()) {}
@@ -20,9 +20,9 @@ namespace screamer {
             lastValidValue = std::numeric_limits<double>::quiet_NaN();
         }
 
-    private:
+        bool supports_inplace() const override { return true; }
 
-        double process_scalar(double newValue) override {
+        double step(double newValue) {
             if (!isnan2(newValue)) {
                 lastValidValue = newValue;
             }
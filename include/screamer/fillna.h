@@ -14,15 +14,15 @@ namespace py = pybind11;
 
 namespace screamer {
 
-    class FillNa : public ScreamerBase {
+    class FillNa : public ScreamerKernel<FillNa> {
     public:
 
         FillNa(double fill) : fill_(fill) {}
 
 
-    private:
+        bool supports_inplace() const override { return true; }
 
-        double process_scalar(double newValue) override {
+        double step(double newValue) {
             if (isnan2(newValue)) {
                 return fill_;
             }
@@ -59,11 +59,7 @@ namespace screamer {
             size_t xi = 0;
 
             for (size_t i=0; i<size; i++) {
-                if (isnan2(y[yi])) {
-                    y[yi] = fill_;
-                } else {
-                    y[yi] = x[xi];
-                }
+                y[yi] = isnan2(x[xi]) ? fill_ : x[xi];
                 xi += dxi;
                 yi += dyi;
             } 
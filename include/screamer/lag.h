@@ -11,7 +11,7 @@ namespace py = pybind11;
 
 namespace screamer {
 
-    class Lag : public ScreamerBase {
+    class Lag : public ScreamerKernel<Lag> {
     public:
 
         Lag(int window_size, const std::string& start_policy = "strict") : 
@@ -23,30 +23,32 @@ namespace screamer {
             delay_buffer_.reset();
         }
         
-        double process_scalar(double newValue) override {
+        double step(double newValue) {
 
             return delay_buffer_.append(newValue);         
         }
 
-        void process_array_no_stride(double* y,  const double* x, size_t size) override {
+        template <typename T>
+        void array_no_stride(T* y,  const T* x, size_t size) {
             size_t window_size_ = delay_buffer_.capacity();
             size_t split = std::min<size_t>(window_size_, size);
 
-            for (int i=0; i < split; ++i) {
-                y[i] = delay_buffer_.append(x[i]);
+            for (size_t i=0; i < split; ++i) {
+                y[i] = static_cast<T>(delay_buffer_.append(x[i]));
             }
 
             if (size > window_size_) {
-                std::memcpy(y + window_size_, x, (size - window_size_) * sizeof(double));
+                std::memcpy(y + window_size_, x, (size - window_size_) * sizeof(T));
             }
         }       
 
-        void process_array_stride(double* y, size_t dyi, const double* x, size_t dxi, size_t size) override {
+        template <typename T>
+        void array_stride(T* y, size_t dyi, const T* x, size_t dxi, size_t size) {
             size_t window_size_ = delay_buffer_.capacity();
             size_t split = std::min<size_t>(window_size_, size);
 
             for (size_t i = 0, xi = 0, yi = 0; i < split; ++i, xi += dxi, yi += dyi) {
-                y[yi] = delay_buffer_.append(x[xi]);
+                y[yi] = static_cast<T>(delay_buffer_.append(x[xi]));
             }
 
             for (size_t i = split, xi = 0, yi = window_size_ * dyi; i < size; ++i, xi += dxi, yi += dyi) {
@@ -9,27 +9,36 @@ namespace py = pybind11;
 
 namespace screamer {
 
-    class Linear : public ScreamerBase {
+    class Linear : public ScreamerKernel<Linear> {
     public:
         Linear(double scale, double shift) : scale_(scale), shift_(shift) {}
 
-        double process_scalar(double newValue) override {
+        bool supports_inplace() const override { return true; }
+
+        double step(double newValue) {
             return scale_ * newValue + shift_;
         }
         
-        void process_array_no_stride(double* y, const double* x, size_t size) override {
+        // Array kernels compute in the value type T, so float arrays use float arithmetic
+        template <typename T>
+        void array_no_stride(T* y, const T* x, size_t size) {
+            const T scale = static_cast<T>(scale_);
+            const T shift = static_cast<T>(shift_);
             for (size_t i=0; i<size; i++) {
-                y[i] = scale_ * x[i] + shift_;
+                y[i] = scale * x[i] + shift;
             }                  
         }
         
-        void process_array_stride(double* y, size_t dyi, const double* x, size_t dxi, size_t size) override {
+        template <typename T>
+        void array_stride(T* y, size_t dyi, const T* x, size_t dxi, size_t size) {
+            const T scale = static_cast<T>(scale_);
+            const T shift = static_cast<T>(shift_);
 
             size_t yi = 0;
             size_t xi = 0;
 
             for (size_t i=0; i<size; i++) {
-                y[yi] = scale_ * x[xi] + shift_;
+                y[yi] = scale * x[xi] + shift;
                 xi += dxi;
                 yi += dyi;
             } 
@@ -13,7 +13,7 @@ namespace py = pybind11;
 
 namespace screamer {
 
-    class LogReturn : public ScreamerBase {
+    class LogReturn : public ScreamerKernel<LogReturn> {
     public:
 
         LogReturn(int window_size) : 
@@ -29,7 +29,7 @@ namespace screamer {
             buffer_.reset(std::numeric_limits<double>::quiet_NaN());
         }
         
-        double process_scalar(double newValue) override {
+        double step(double newValue) {
             double oldValue = buffer_.append(newValue);
             return std::log(newValue / oldValue);     
         }          
@@ -0,0 +1,152 @@
+#ifndef SCREAMER_P2_QUANTILE_H
+#define SCREAMER_P2_QUANTILE_H
+
+#include <limits>
+#include <cmath>
+#include <algorithm>
+#include <pybind11/pybind11.h>
+#include <pybind11/numpy.h>
+#include "screamer/common/base.h"
+#include "screamer/common/float_info.h"
+
+namespace py = pybind11;
+
+namespace screamer {
+
+    // Approximate quantile of all values seen so far, in constant memory, with
+    // the P-square algorithm of Jain and Chlamtac (1985). Five markers track
+    // the minimum, the quantile, the maximum and two quantiles halfway. Their
+    // heights are adjusted with piecewise parabolic interpolation when their
+    // positions drift from the desired positions.
+    class P2Quantile : public ScreamerKernel<P2Quantile> {
+    public:
+
+        P2Quantile(double quantile) :
+            quantile(quantile)
+        {
+            if (quantile < 0.0 || quantile > 1.0) {
+                throw std::invalid_argument("Quantile must be between 0 and 1.");
+            }
+
+            increments[0] = 0.0;
+            increments[1] = quantile / 2.0;
+            increments[2] = quantile;
+            increments[3] = (1.0 + quantile) / 2.0;
+            increments[4] = 1.0;
+            reset();
+        }
+
+        void reset() override
+        {
+            count = 0;
+            for (int i = 0; i < 5; i++) {
+                positions[i] = i;
+            }
+            desired[0] = 0.0;
+            desired[1] = 2.0 * quantile;
+            desired[2] = 4.0 * quantile;
+            desired[3] = 2.0 + 2.0 * quantile;
+            desired[4] = 4.0;
+        }
+
+        double step(double newValue)
+        {
+            if (isnan2(newValue)) {
+                return (count == 0) ? std::numeric_limits<double>::quiet_NaN() : current();
+            }
+
+            // The first five values are the initial marker heights
+            if (count < 5) {
+                heights[count] = newValue;
+                count++;
+                std::sort(heights, heights + count);
+                return current();
+            }
+            count++;
+
+            // Find the cell of the new value, extending the extremes if needed
+            int k;
+            if (newValue < heights[0]) {
+                heights[0] = newValue;
+                k = 0;
+            } else if (newValue >= heights[4]) {
+                heights[4] = newValue;
+                k = 3;
+            } else {
+                k = 0;
+                while (newValue >= heights[k + 1]) {
+                    k++;
+                }
+            }
+
+            for (int i = k + 1; i < 5; i++) {
+                positions[i]++;
+            }
+            for (int i = 0; i < 5; i++) {
+                desired[i] += increments[i];
+            }
+
+            // Move the middle markers towards their desired positions
+            for (int i = 1; i < 4; i++) {
+                double d = desired[i] - positions[i];
+                if ((d >= 1.0 && positions[i + 1] - positions[i] > 1) ||
+                    (d <= -1.0 && positions[i - 1] - positions[i] < -1)
+                ) {
+                    int sign = (d > 0.0) ? 1 : -1;
+                    double height = parabolic(i, sign);
+                    if (heights[i - 1] < height && height < heights[i + 1]) {
+                        heights[i] = height;
+                    } else {
+                        heights[i] = linear(i, sign);
+                    }
+                    positions[i] += sign;
+                }
+            }
+
+            return heights[2];
+        }
+
+    private:
+        double quantile;
+        long long count;            // number of non-NaN values seen
+        double heights[5];          // marker heights
+        long long positions[5];     // marker positions
+        double desired[5];          // desired marker positions
+        double increments[5];       // increments of the desired positions
+
+        // Exact quantile of the first few values, interpolated as in RollingQuantile
+        double current() const
+        {
+            if (count > 5) {
+                return heights[2];
+            }
+            double pos = quantile * (count - 1);
+            int index = static_cast<int>(std::floor(pos));
+            double fraction = pos - index;
+            if (index + 1 >= count) {
+                return heights[index];
+            }
+            return heights[index] + fraction * (heights[index + 1] - heights[index]);
+        }
+
+        double parabolic(int i, int d) const
+        {
+            double n_lo = static_cast<double>(positions[i - 1]);
+            double n = static_cast<double>(positions[i]);
+            double n_hi = static_cast<double>(positions[i + 1]);
+            return heights[i] + d / (n_hi - n_lo) * (
+                (n - n_lo + d) * (heights[i + 1] - heights[i]) / (n_hi - n) +
+                (n_hi - n - d) * (heights[i] - heights[i - 1]) / (n - n_lo)
+            );
+        }
+
+        double linear(int i, int d) const
+        {
+            return heights[i] + d * (heights[i + d] - heights[i]) / static_cast<double>(positions[i + d] - positions[i]);
+        }
+
+    }; // end of class
+
+} // end of namespace
+
+#endif // SCREAMER_P2_QUANTILE_H
@@ -0,0 +1,129 @@
+#ifndef SCREAMER_PIPELINE_H
+#define SCREAMER_PIPELINE_H
+
+#include <memory>
+#include <vector>
+#include <string>
+#include <stdexcept>
+#include <algorithm>
+#include "screamer/common/base.h"
+
+namespace screamer {
+
+    // A chain of operators applied one after the other, Pipeline([a, b, c])(x)
+    // gives c(b(a(x))) without intermediate arrays and without going back to
+    // Python between the stages.
+    //
+    // Arrays are pushed through the stages in small blocks that stay in L1, each
+    // stage processes a block in-place with its process_array_update loop.
+    class Pipeline : public ScreamerBase {
+    public:
+        // The stages are copied, the pipeline doesn't change the state of the
+        // objects that are passed in.
+        explicit Pipeline(const std::vector<ScreamerBase*>& stages) {
+            if (stages.empty()) {
+                throw std::invalid_argument("A pipeline needs at least one stage.");
+            }
+            for (const ScreamerBase* stage : stages) {
+                if (!stage) {
+                    throw std::invalid_argument("Pipeline stages can't be None.");
+                }
+                if (stage->output_size() > 0) {
+                    throw std::invalid_argument("Pipeline stages must have a single output.");
+                }
+                std::unique_ptr<ScreamerBase> c = stage->clone();
+                if (!c) {
+                    throw std::invalid_argument("Pipeline stages must support copying.");
+                }
+                stages_.push_back(std::move(c));
+            }
+        }
+
+        Pipeline(const Pipeline& other) {
+            for (size_t i = 0; i < other.stages_.size(); i++) {
+                std::unique_ptr<ScreamerBase> c = other.stages_[i]->clone();
+                if (!c) {
+                    throw std::runtime_error("Pipeline stage " + std::to_string(i) + " could not be copied.");
+                }
+                stages_.push_back(std::move(c));
+            }
+        }
+
+        std::unique_ptr<ScreamerBase> clone() const override {
+            return std::make_unique<Pipeline>(*this);
+        }
+
+        void reset() override {
+            for (auto& stage : stages_) {
+                stage->reset();
+            }
+        }
+
+        // Number of stages
+        size_t size() const { return stages_.size(); }
+
+        // Blocks are copied before the stages write, so out=x is safe
+        bool supports_inplace() const override { return true; }
+
+        double process_scalar(double value) override {
+            for (auto& stage : stages_) {
+                value = stage->process_scalar(value);
+            }
+            return value;
+        }
+
+        void process_array_no_stride(double* y, const double* x, size_t size) override {
+            process_blocks(y, 1, x, 1, size);
+        }
+
+        void process_array_no_stride(float* y, const float* x, size_t size) override {
+            process_blocks(y, 1, x, 1, size);
+        }
+
+        void process_array_stride(double* y, size_t dy, const double* x, size_t dx, size_t size) override {
+            process_blocks(y, dy, x, dx, size);
+        }
+
+        void process_array_stride(float* y, size_t dy, const float* x, size_t dx, size_t size) override {
+            process_blocks(y, dy, x, dx, size);
+        }
+
+        void process_array_update(double* y, size_t dy, const double* x, size_t dx, size_t size) override {
+            process_blocks(y, dy, x, dx, size);
+        }
+
+        void process_array_update(float* y, size_t dy, const float* x, size_t dx, size_t size) override {
+            process_blocks(y, dy, x, dx, size);
+        }
+
+        // Number of values per block
+        static constexpr size_t block_size = 256;
+
+    private:
+        // Copy a block of x into a double buffer, let all stages update it in-place,
+        // and copy the result to y. Intermediate values stay double for float arrays.
+        template <typename T>
+        void process_blocks(T* y, size_t dy, const T* x, size_t dx, size_t size) {
+            double block[block_size];
+
+            for (size_t start = 0; start < size; start += block_size) {
+                const size_t n = std::min(block_size, size - start);
+
+                for (size_t i = 0; i < n; ++i) {
+                    block[i] = x[(start + i) * dx];
+                }
+                for (auto& stage : stages_) {
+                    stage->process_array_update(block, 1, block, 1, n);
+                }
+                for (size_t i = 0; i < n; ++i) {
+                    y[(start + i) * dy] = static_cast<T>(block[i]);
+                }
+            }
+        }
+
+        std::vector<std::unique_ptr<ScreamerBase>> stages_;
+    };
+
+} // namespace screamer
+
+#endif // SCREAMER_PIPELINE_H
@@ -10,11 +10,13 @@ namespace py = pybind11;
 
 namespace screamer {
 
-    class Power : public ScreamerBase {
+    class Power : public ScreamerKernel<Power> {
     public:
         Power(double p) : p_(p) {}
 
-        double process_scalar(double newValue) override {
+        bool supports_inplace() const override { return true; }
+
+        double step(double newValue) {
             return std::pow(newValue, p_);
         }
         
@@ -12,7 +12,7 @@ namespace py = pybind11;
 
 namespace screamer {
 
-    class Return : public ScreamerBase {
+    class Return : public ScreamerKernel<Return> {
     public:
 
         Return(int window_size) : 
@@ -28,7 +28,7 @@ namespace screamer {
             buffer_.reset(std::numeric_limits<double>::quiet_NaN());
         }
         
-        double process_scalar(double newValue) override {
+        double step(double newValue) {
             double oldValue = buffer_.append(newValue);
             return (newValue - oldValue) / oldValue;     
         }          
@@ -0,0 +1,43 @@
+#ifndef SCREAMER_ROLLING_ALL_H
+#define SCREAMER_ROLLING_ALL_H
+
+#include <pybind11/pybind11.h>
+#include <pybind11/numpy.h>
+#include "screamer/common/base.h"
+#include "screamer/common/sliding_aggregator.h"
+#include "screamer/common/float_info.h"
+
+namespace py = pybind11;
+
+namespace screamer {
+
+    struct AndMonoid {
+        using value_type = char;    // not bool, std::vector<bool> packs bits
+        static char combine(char older, char newer) { return older && newer; }
+    };
+
+    // 1 if all values in the window are non-zero, 0 otherwise, NaN values
+    // count as zero
+    class RollingAll : public ScreamerKernel<RollingAll> {
+    public:
+
+        RollingAll(int window_size) :
+            aggregator(window_size)
+        {}
+
+        void reset() override {
+            aggregator.clear();
+        }
+
+        double step(double newValue) {
+            return aggregator.push(newValue != 0.0 && !isnan2(newValue)) ? 1.0 : 0.0;
+        }
+
+    private:
+        SlidingAggregator<AndMonoid> aggregator;
+
+    }; // end of class
+
+} // end of namespace
+
+#endif // end of include guards
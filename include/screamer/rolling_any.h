@@ -0,0 +1,43 @@
+#ifndef SCREAMER_ROLLING_ANY_H
+#define SCREAMER_ROLLING_ANY_H
+
+#include <pybind11/pybind11.h>
+#include <pybind11/numpy.h>
+#include "screamer/common/base.h"
+#include "screamer/common/sliding_aggregator.h"
+#include "screamer/common/float_info.h"
+
+namespace py = pybind11;
+
+namespace screamer {
+
+    struct OrMonoid {
+        using value_type = char;    // not bool, std::vector<bool> packs bits
+        static char combine(char older, char newer) { return older || newer; }
+    };
+
+    // 1 if any value in the window is non-zero, 0 otherwise, NaN values
+    // count as zero
+    class RollingAny : public ScreamerKernel<RollingAny> {
+    public:
+
+        RollingAny(int window_size) :
+            aggregator(window_size)
+        {}
+
+        void reset() override {
+            aggregator.clear();
+        }
+
+        double step(double newValue) {
+            return aggregator.push(newValue != 0.0 && !isnan2(newValue)) ? 1.0 : 0.0;
+        }
+
+    private:
+        SlidingAggregator<OrMonoid> aggregator;
+
+    }; // end of class
+
+} // end of namespace
+
+#endif // end of include guards
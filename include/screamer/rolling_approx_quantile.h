@@ -0,0 +1,275 @@
+#ifndef SCREAMER_ROLLING_APPROX_QUANTILE_H
+#define SCREAMER_ROLLING_APPROX_QUANTILE_H
+
+#include <vector>
+#include <limits>
+#include <cmath>
+#include <cstdint>
+#include <algorithm>
+#include <pybind11/pybind11.h>
+#include <pybind11/numpy.h>
+#include "screamer/common/base.h"
+#include "screamer/common/sorted_blocks.h"
+#include "screamer/common/float_info.h"
+
+namespace py = pybind11;
+
+namespace screamer {
+
+    // Approximate rolling quantile with a bounded rank error, keeping only a
+    // summary of most of the window.
+    //
+    // The stream is cut in blocks of rank_error * window_size / 4 values. The
+    // newest block is kept exactly. A completed block is summarized by 2 /
+    // rank_error of its order statistics, at the middle of equal rank
+    // intervals, each standing for block_size / points values. A summary is
+    // dropped when more than half of its block has left the window. The
+    // quantile is selected from the sorted summary points and the exact
+    // newest block, weighted by the number of values they stand for.
+    //
+    // Summarizing adds at most rank_error * window_size / 4 to the rank error,
+    // dropping whole blocks at most another rank_error * window_size / 4, and
+    // the rounding of the block boundaries 4 / rank_error. The rank error is
+    // therefore below rank_error * window_size when window_size >= 8 /
+    // rank_error^2. Summaries of smaller windows would be as large as the
+    // window itself, those windows are kept exactly instead.
+    class RollingApproxQuantile : public ScreamerKernel<RollingApproxQuantile> {
+    public:
+
+        RollingApproxQuantile(int window_size, double quantile, double rank_error = 0.01) :
+            window_size(window_size),
+            quantile(quantile),
+            partial(1),
+            window(1)
+        {
+            if (window_size <= 0) {
+                throw std::invalid_argument("Window size must be positive.");
+            }
+            if (quantile < 0.0 || quantile > 1.0) {
+                throw std::invalid_argument("Quantile must be between 0 and 1.");
+            }
+            if (!(rank_error > 0.0 && rank_error < 1.0)) {
+                throw std::invalid_argument("Rank error must be between 0 and 1.");
+            }
+
+            block_size = std::max(1, static_cast<int>(rank_error * window_size / 4));
+            points = std::min(block_size, static_cast<int>(std::ceil(2.0 / rank_error)));
+            max_blocks = window_size / block_size + 2;
+            weight = static_cast<double>(block_size) / points;
+            exact = (points == block_size);
+
+            if (exact) {
+                values.resize(window_size);
+                window = SortedBlocks(window_size);
+            } else {
+                partial = SortedBlocks(block_size);
+                summaries.resize(static_cast<size_t>(max_blocks) * points);
+                summary_sizes.resize(max_blocks);
+                block_starts.resize(max_blocks);
+                sorted.reserve(summaries.size());
+                scratch.reserve(summaries.size());
+            }
+            reset();
+        }
+
+        void reset() override
+        {
+            tick = 0;
+            last_nan = std::numeric_limits<int64_t>::min() / 2;
+            block_ticks = 0;
+            first_block = 0;
+            num_blocks = 0;
+            cursor = 0;
+            partial.clear();
+            sorted.clear();
+            std::fill(values.begin(), values.end(), std::numeric_limits<double>::quiet_NaN());
+            window.clear();
+        }
+
+        double step(double newValue)
+        {
+            if (exact) {
+                return step_exact(newValue);
+            }
+
+            if (isnan2(newValue)) {
+                last_nan = tick;
+            } else {
+                partial.insert(newValue);
+            }
+
+            block_ticks++;
+            if (block_ticks == block_size) {
+                complete_block();
+            }
+            tick++;
+
+            // Drop summaries of blocks that are more than half outside the window
+            while (num_blocks > 0 && 2 * (tick - window_size - block_starts[first_block]) > block_size) {
+                drop_block();
+            }
+
+            if (tick < window_size || last_nan >= tick - window_size) {
+                return std::numeric_limits<double>::quiet_NaN();
+            }
+            return select();
+        }
+
+    private:
+        int window_size;
+        double quantile;
+        int block_size;                     // values per block
+        int points;                         // summary points per block
+        int max_blocks;                     // capacity of the ring of summaries
+        bool exact;                         // keep the window exactly
+        double weight;                      // number of values a summary point stands for
+
+        int64_t tick;                       // number of values seen
+        int64_t last_nan;                   // tick of the last NaN
+        int block_ticks;                    // number of values in the current block
+
+        SortedBlocks partial;               // the non-NaN values of the current block
+        std::vector<double> summaries;      // ring of summaries, points values per block
+        std::vector<int> summary_sizes;     // number of points in the summaries
+        std::vector<int64_t> block_starts;  // tick of the first value of the blocks
+        int first_block;                    // ring index of the oldest summary
+        int num_blocks;                     // number of summaries in the ring
+
+        std::vector<double> sorted;         // all summary points, sorted
+        std::vector<double> scratch;        // merge buffer for sorted
+        size_t cursor;                      // index in sorted of the last selection
+
+        std::vector<double> values;         // ring buffer with the window, if exact
+        SortedBlocks window;                // the sorted window, if exact
+
+        double step_exact(double newValue)
+        {
+            double& slot = values[tick % window_size];
+            double oldValue = slot;
+            slot = newValue;
+            if (!isnan2(oldValue)) {
+                window.erase(oldValue);
+            }
+            if (isnan2(newValue)) {
+                last_nan = tick;
+            } else {
+                window.insert(newValue);
+            }
+            tick++;
+
+            if (tick < window_size || last_nan >= tick - window_size) {
+                return std::numeric_limits<double>::quiet_NaN();
+            }
+            return window.kth_element(static_cast<int>(quantile * (window.size() - 1)));
+        }
+
+        // Summarize the current block and add it to the sorted summary points
+        void complete_block()
+        {
+            int slot = (first_block + num_blocks) % max_blocks;
+            double* summary = summaries.data() + static_cast<size_t>(slot) * points;
+
+            // Blocks with NaN have fewer values, sample them at the same ranks
+            int count = partial.size();
+            int size = (count == 0) ? 0 : points;
+            for (int i = 0; i < size; i++) {
+                summary[i] = partial.kth_element(static_cast<int>((i + 0.5) * count / points));
+            }
+            summary_sizes[slot] = size;
+            block_starts[slot] = tick - block_size + 1;
+            num_blocks++;
+
+            scratch.clear();
+            std::merge(sorted.begin(), sorted.end(), summary, summary + size, std::back_inserter(scratch));
+            sorted.swap(scratch);
+
+            partial.clear();
+            block_ticks = 0;
+        }
+
+        // Remove the oldest summary from the sorted summary points
+        void drop_block()
+        {
+            const double* summary = summaries.data() + static_cast<size_t>(first_block) * points;
+            const double* summary_end = summary + summary_sizes[first_block];
+
+            scratch.clear();
+            for (double value : sorted) {
+                if (summary != summary_end && value == *summary) {
+                    summary++;
+                } else {
+                    scratch.push_back(value);
+                }
+            }
+            sorted.swap(scratch);
+
+            first_block = (first_block + 1) % max_blocks;
+            num_blocks--;
+        }
+
+        // The value at the quantile rank of the summary points, with weight
+        // each, merged with the exact values of the current block
+        double select()
+        {
+            size_t num_sorted = sorted.size();
+            int num_partial = partial.size();
+            double rank = quantile * (weight * num_sorted + num_partial - 1);
+
+            if (num_partial == 0) {
+                if (num_sorted == 0) {
+                    return std::numeric_limits<double>::quiet_NaN();
+                }
+                return sorted[std::min(static_cast<size_t>(rank / weight), num_sorted - 1)];
+            }
+
+            // The first summary point whose weight extends beyond the rank, the
+            // position of point k is weight * k plus the smaller partial values.
+            // The rank moves little per step, so we first look near the previous
+            // point and fall back to a binary search.
+            auto beyond = [&](size_t k) {
+                return weight * (k + 1) + partial.rank(sorted[k]) > rank;
+            };
+
+            size_t k = std::min(cursor, num_sorted);
+            int walk = 0;
+            if (k < num_sorted && beyond(k)) {
+                while (k > 0 && walk < 8 && beyond(k - 1)) {
+                    k--;
+                    walk++;
+                }
+            } else {
+                while (k < num_sorted && walk < 8 && !beyond(k)) {
+                    k++;
+                    walk++;
+                }
+            }
+            if (walk == 8) {
+                size_t lo = 0;
+                size_t hi = num_sorted;
+                while (lo < hi) {
+                    size_t mid = (lo + hi) / 2;
+                    if (beyond(mid)) {
+                        hi = mid;
+                    } else {
+                        lo = mid + 1;
+                    }
+                }
+                k = lo;
+            }
+            cursor = k;
+
+            if (k < num_sorted && weight * k + partial.rank(sorted[k]) <= rank) {
+                return sorted[k];
+            }
+
+            // The rank falls on a value of the current block
+            int j = static_cast<int>(rank - weight * k);
+            j = std::max(0, std::min(j, num_partial - 1));
+            return partial.kth_element(j);
+        }
+
+    }; // end of class
+
+} // end of namespace
+
+#endif // SCREAMER_ROLLING_APPROX_QUANTILE_H
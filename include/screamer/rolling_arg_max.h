@@ -0,0 +1,79 @@
+#ifndef SCREAMER_ROLLING_ARG_MAX_H
+#define SCREAMER_ROLLING_ARG_MAX_H
+
+#include <pybind11/pybind11.h>
+#include <pybind11/numpy.h>
+#include "screamer/common/base.h"
+#include "screamer/common/sliding_extremes.h"
+
+namespace py = pybind11;
+
+namespace screamer {
+
+    // The number of values since the maximum of the window, 0 when the newest
+    // value is the maximum, the newest of equal values counts. With with_value
+    // the result has an extra last dimension with the maximum and its age.
+    class RollingArgMax : public ScreamerKernel<RollingArgMax> {
+    public:
+
+        RollingArgMax(int window_size, bool with_value = false) :
+            window_size_(window_size),
+            with_value(with_value),
+            queue(window_size)
+        {
+            if (window_size <= 0) {
+                throw std::invalid_argument("Window size must be positive.");
+            }
+        }
+
+        void reset() override {
+            queue.clear();
+        }
+
+        size_t output_size() const override {
+            return with_value ? 2 : 0;
+        }
+
+        double step(double newValue) {
+            queue.push(newValue);
+            return queue.age();
+        }
+
+        void process_scalar_multi(double newValue, double* results) override {
+            results[0] = queue.push(newValue);
+            results[1] = queue.age();
+        }
+
+        // Arrays use the van Herk / Gil-Werman block algorithm
+        template <typename T>
+        void array_no_stride(T* y, const T* x, size_t size) {
+            array_stride(y, 1, x, 1, size);
+        }
+
+        template <typename T>
+        void array_stride(T* y, size_t dy, const T* x, size_t dx, size_t size) {
+            if (has_nan(x, dx, size)) {
+                ScreamerKernel::array_stride(y, dy, x, dx, size);
+                return;
+            }
+            BlockArgExtremes<MaxOrder> blocks(window_size_);
+            for (size_t start = 0; start < size; start += window_size_) {
+                int len = static_cast<int>(std::min<size_t>(window_size_, size - start));
+                blocks.next_block(x + start * dx, dx, len);
+                const int* age = blocks.ages();
+                for (int j = 0; j < len; j++) {
+                    y[(start + j) * dy] = static_cast<T>(age[j]);
+                }
+            }
+        }
+
+    private:
+        const int window_size_;
+        bool with_value;
+        MonotonicQueue<MaxOrder> queue;  // candidates for the maximum of the window
+
+    }; // end of class
+
+} // end of namespace
+
+#endif // end of include guards
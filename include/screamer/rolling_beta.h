@@ -0,0 +1,84 @@
+#ifndef SCREAMER_ROLLING_BETA_H
+#define SCREAMER_ROLLING_BETA_H
+
+#include <pybind11/pybind11.h>
+#include <pybind11/numpy.h>
+#include "screamer/detail/rolling_sum.h"
+#include "screamer/common/base2.h"
+#include "screamer/common/math.h"
+#include "screamer/common/window_sums.h"
+
+namespace py = pybind11;
+
+namespace screamer {
+
+    // Rolling beta of y on x, the slope of the least squares regression
+    // y = a + b * x over the window: cov(x, y) / var(x).
+    class RollingBeta : public ScreamerKernel2<RollingBeta> {
+    public:
+
+        RollingBeta(int window_size, const std::string& start_policy = "strict") :
+            window_size_(window_size),
+            start_policy_(detail::parse_start_policy(start_policy)),
+            sum_x_buffer(window_size, start_policy),
+            sum_y_buffer(window_size, start_policy),
+            sum_xy_buffer(window_size, start_policy),
+            sum_xx_buffer(window_size, start_policy)
+        {
+            if (window_size_ < 2) {
+                throw std::invalid_argument("Window size must be 2 or more.");
+            }
+
+            reset();
+        }
+
+        void reset() override {
+            sum_x_buffer.reset();
+            sum_y_buffer.reset();
+            sum_xy_buffer.reset();
+            sum_xx_buffer.reset();
+            n_ = (start_policy_ != detail::StartPolicy::Zero) ? 0 : window_size_;
+        }
+
+        double step(double x, double y) {
+            if ((n_ < window_size_) && (start_policy_ != detail::StartPolicy::Zero)) {
+                n_++;
+            }
+            double sum_x = sum_x_buffer.append(x);
+            double sum_y = sum_y_buffer.append(y);
+            double sum_xy = sum_xy_buffer.append(x * y);
+            double sum_xx = sum_xx_buffer.append(x * x);
+            double beta;
+            beta_from_stats(sum_x, sum_y, sum_xy, sum_xx, n_, beta);
+            return beta;
+        }
+
+        // Arrays sum the windows with WindowSums, see window_sums_apply()
+        template <typename T>
+        void array_no_stride(T* r, const T* x, const T* y, size_t size) {
+            array_stride(r, 1, x, 1, y, 1, size);
+        }
+
+        template <typename T>
+        void array_stride(T* r, size_t dr, const T* x, size_t dx, const T* y, size_t dy, size_t size) {
+            const int n = window_size_;
+            window_sums_apply<4>(*this, window_size_, r, dr, x, dx, y, dy, size, [n](const double* s, size_t) {
+                double beta;
+                beta_from_stats(s[0], s[1], s[2], s[3], n, beta);
+                return beta;
+            });
+        }
+
+    private:
+        const int window_size_;
+        const detail::StartPolicy start_policy_;
+        int n_;
+        detail::RollingSum sum_x_buffer;
+        detail::RollingSum sum_y_buffer;
+        detail::RollingSum sum_xy_buffer;
+        detail::RollingSum sum_xx_buffer;
+    }; // end of class
+
+} // end of namespace
+
+#endif // SCREAMER_ROLLING_BETA_H
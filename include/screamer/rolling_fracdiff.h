@@ -17,7 +17,7 @@ namespace py = pybind11;
 
 namespace screamer {
 
-    class RollingFracDiff : public ScreamerBase {
+    class RollingFracDiff : public ScreamerKernel<RollingFracDiff> {
     public:
     
         RollingFracDiff(double frac_order, int window_size, double threshold=1e-5):
@@ -41,7 +41,7 @@ namespace screamer {
             }
         }
     
-        double process_scalar(double newValue) override {
+        double step(double newValue) {
             if (buffer.size() == window_size) {
                 buffer.pop_front();
             }
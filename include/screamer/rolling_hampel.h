@@ -0,0 +1,69 @@
+#ifndef SCREAMER_ROLLING_HAMPEL_H
+#define SCREAMER_ROLLING_HAMPEL_H
+
+#include <limits>
+#include <string>
+#include <cmath>
+#include <pybind11/pybind11.h>
+#include <pybind11/numpy.h>
+#include "screamer/common/base.h"
+#include "screamer/common/median_mad.h"
+
+namespace py = pybind11;
+
+namespace screamer {
+
+    // Hampel filter: values that are more than n_sigmas robust standard
+    // deviations from the median of the window are outliers, and are
+    // replaced by the median. The robust standard deviation is the median
+    // absolute deviation scaled to the standard deviation of a normal
+    // distribution.
+    class RollingHampel : public ScreamerKernel<RollingHampel> {
+    public:
+
+        RollingHampel(int window_size, double n_sigmas = 3.0, const std::string& output = "filtered") :
+            n_sigmas(n_sigmas),
+            flag(output == "flag"),
+            window(window_size)
+        {
+            if (n_sigmas < 0.0) {
+                throw std::invalid_argument("n_sigmas must be non-negative.");
+            }
+            if (output != "filtered" && output != "flag") {
+                throw std::invalid_argument("Output must be 'filtered' or 'flag'.");
+            }
+        }
+
+        void reset() override
+        {
+            window.clear();
+        }
+
+        double step(double newValue)
+        {
+            if (!window.append(newValue)) {
+                return std::numeric_limits<double>::quiet_NaN();
+            }
+            double median = window.median();
+            double sigma = normal_scale * window.mad(median);
+            bool outlier = std::abs(newValue - median) > n_sigmas * sigma;
+
+            if (flag) {
+                return outlier ? 1.0 : 0.0;
+            }
+            return outlier ? median : newValue;
+        }
+
+    private:
+        // 1 / Phi^-1(3/4), the MAD of a normal distribution is sigma / 1.4826
+        static constexpr double normal_scale = 1.482602218505602;
+
+        double n_sigmas;
+        bool flag;
+        MedianMad window;
+
+    }; // end of class
+
+} // end of namespace
+
+#endif // end of include guards
@@ -5,6 +5,7 @@
 #include <pybind11/pybind11.h>
 #include <pybind11/numpy.h>
 #include "screamer/common/base.h"
+#include "screamer/common/window_sums.h"
 #include "screamer/common/math.h"
 #include "screamer/detail/rolling_sum.h"
 
@@ -12,7 +13,7 @@ namespace py = pybind11;
 
 namespace screamer {
 
-    class RollingKurt : public ScreamerBase {
+    class RollingKurt : public ScreamerKernel<RollingKurt> {
     public:
 
         RollingKurt(
@@ -44,9 +45,7 @@ namespace screamer {
             kurt_n_const(n_, c0, c1, c2);
         }
         
-    private:
-
-        double process_scalar(double newValue) override {
+        double step(double newValue) {
 
             if ((n_ < window_size_) && (start_policy_ != detail::StartPolicy::Zero) ) {
                 n_++;
@@ -65,6 +64,24 @@ namespace screamer {
             return kurt;
         }
 
+        // Arrays sum the windows with WindowSums, see window_sums_apply()
+        template <typename T>
+        void array_no_stride(T* y, const T* x, size_t size) {
+            array_stride(y, 1, x, 1, size);
+        }
+
+        template <typename T>
+        void array_stride(T* y, size_t dy, const T* x, size_t dx, size_t size) {
+            const int n = window_size_;
+            double k0, k1, k2;
+            kurt_n_const(n, k0, k1, k2);
+            window_sums_apply<4>(*this, window_size_, y, dy, x, dx, size, [n, k0, k1, k2](const double* s, size_t) {
+                double kurt;
+                kurt_from_stats(s[0], s[1], s[2], s[3], k0, k1, k2, n, kurt);
+                return kurt;
+            });
+        }
+
     private:
         const int window_size_;
         const detail::StartPolicy start_policy_;
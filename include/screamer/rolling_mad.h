@@ -0,0 +1,42 @@
+#ifndef SCREAMER_ROLLING_MAD_H
+#define SCREAMER_ROLLING_MAD_H
+
+#include <limits>
+#include <pybind11/pybind11.h>
+#include <pybind11/numpy.h>
+#include "screamer/common/base.h"
+#include "screamer/common/median_mad.h"
+
+namespace py = pybind11;
+
+namespace screamer {
+
+    // Median absolute deviation from the median of the window
+    class RollingMAD : public ScreamerKernel<RollingMAD> {
+    public:
+
+        RollingMAD(int window_size) :
+            window(window_size)
+        {}
+
+        void reset() override
+        {
+            window.clear();
+        }
+
+        double step(double newValue)
+        {
+            if (!window.append(newValue)) {
+                return std::numeric_limits<double>::quiet_NaN();
+            }
+            return window.mad(window.median());
+        }
+
+    private:
+        MedianMad window;
+
+    }; // end of class
+
+} // end of namespace
+
+#endif // end of include guards
@@ -1,22 +1,21 @@
 #ifndef SCREAMER_ROLLING_MAX_H
 #define SCREAMER_ROLLING_MAX_H
 
-#include <deque>
 #include <pybind11/pybind11.h>
 #include <pybind11/numpy.h>
-#include <screamer/common/buffer.h>
 #include "screamer/common/base.h"
+#include "screamer/common/sliding_extremes.h"
 
 namespace py = pybind11;
 
 namespace screamer {
 
-    class RollingMax : public ScreamerBase {
+    class RollingMax : public ScreamerKernel<RollingMax> {
     public:
 
         RollingMax(int window_size) : 
             window_size_(window_size), 
-            index(0)
+            queue(window_size)
         {
             if (window_size <= 0) {
                 throw std::invalid_argument("Window size must be positive.");
@@ -24,36 +23,38 @@ namespace screamer {
         }
 
         void reset() override {
-            max_deque.clear();
-            index = 0;    
+            queue.clear();
         }
         
-    private:
-
-        double process_scalar(double newValue) override {
-            // Remove elements from the back that are smaller than the new value
-            while (!max_deque.empty() && max_deque.back().first <= newValue) {
-                max_deque.pop_back();
-            }
+        double step(double newValue) {
+            return queue.push(newValue);
+        }
 
-            // Add the new value and its index to the deque
-            max_deque.emplace_back(newValue, index);
+        // Arrays use the van Herk / Gil-Werman block algorithm
+        template <typename T>
+        void array_no_stride(T* y, const T* x, size_t size) {
+            array_stride(y, 1, x, 1, size);
+        }
 
-            // Remove the front element if it's outside the window
-            if (max_deque.front().second <= index - window_size_) {
-                max_deque.pop_front();
+        template <typename T>
+        void array_stride(T* y, size_t dy, const T* x, size_t dx, size_t size) {
+            if (has_nan(x, dx, size)) {
+                ScreamerKernel::array_stride(y, dy, x, dx, size);
+                return;
+            }
+            BlockExtremes<MaxOrder> blocks(window_size_);
+            for (size_t start = 0; start < size; start += window_size_) {
+                int len = static_cast<int>(std::min<size_t>(window_size_, size - start));
+                const double* maximum = blocks.next_block(x + start * dx, dx, len);
+                for (int j = 0; j < len; j++) {
+                    y[(start + j) * dy] = static_cast<T>(maximum[j]);
+                }
             }
-
-            index++;
-
-            // The front of the deque contains the maximum value in the window
-            return max_deque.front().first;
         }
 
     private:
     const int window_size_;
-    int index; // Current index
-    std::deque<std::pair<double, int>> max_deque; // Stores pairs of (value, index)
+    MonotonicQueue<MaxOrder> queue; // candidates for the maximum of the window
 
     }; // end of class
 
@@ -0,0 +1,43 @@
+#ifndef SCREAMER_ROLLING_MAX_ABS_H
+#define SCREAMER_ROLLING_MAX_ABS_H
+
+#include <cmath>
+#include <algorithm>
+#include <pybind11/pybind11.h>
+#include <pybind11/numpy.h>
+#include "screamer/common/base.h"
+#include "screamer/common/sliding_aggregator.h"
+
+namespace py = pybind11;
+
+namespace screamer {
+
+    struct MaxMonoid {
+        using value_type = double;
+        static double combine(double older, double newer) { return std::max(older, newer); }
+    };
+
+    // Largest absolute value in the window
+    class RollingMaxAbs : public ScreamerKernel<RollingMaxAbs> {
+    public:
+
+        RollingMaxAbs(int window_size) :
+            aggregator(window_size)
+        {}
+
+        void reset() override {
+            aggregator.clear();
+        }
+
+        double step(double newValue) {
+            return aggregator.push(std::abs(newValue));
+        }
+
+    private:
+        SlidingAggregator<MaxMonoid> aggregator;
+
+    }; // end of class
+
+} // end of namespace
+
+#endif // end of include guards
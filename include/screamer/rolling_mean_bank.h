@@ -0,0 +1,46 @@
+#ifndef SCREAMER_ROLLING_MEAN_BANK_H
+#define SCREAMER_ROLLING_MEAN_BANK_H
+
+#include <limits>
+#include <algorithm>
+#include "screamer/common/bank.h"
+#include "screamer/detail/rolling_sum_bank.h"
+
+namespace screamer {
+
+    // RollingMean of n series at once, see ScreamerBank
+    class RollingMeanBank : public ScreamerBank {
+    public:
+        RollingMeanBank(int n, int window_size, const std::string& start_policy = "strict") :
+            ScreamerBank(n),
+            rolling_sum_(n, window_size, start_policy)
+        {}
+
+        void reset() override {
+            rolling_sum_.reset();
+        }
+
+        void process_row(double* y, const double* x) override {
+            const double* sum = rolling_sum_.append(x);
+            if (!sum) {
+                std::fill(y, y + n_, std::numeric_limits<double>::quiet_NaN());
+                return;
+            }
+
+            // Same start policies as detail::RollingMean
+            double count = static_cast<double>(rolling_sum_.capacity());
+            if (rolling_sum_.start_policy() == detail::StartPolicy::Expanding) {
+                count = static_cast<double>(rolling_sum_.size());
+            }
+            for (size_t c = 0; c < n_; ++c) {
+                y[c] = sum[c] / count;
+            }
+        }
+
+    private:
+        detail::RollingSumBank rolling_sum_;
+    };
+
+} // namespace screamer
+
+#endif // SCREAMER_ROLLING_MEAN_BANK_H
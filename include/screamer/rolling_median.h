@@ -1,23 +1,24 @@
 #ifndef SCREAMER_ROLLING_MEDIAN_H
 #define SCREAMER_ROLLING_MEDIAN_H
 
-#include <deque>
+#include <limits>
 #include <pybind11/pybind11.h>
 #include <pybind11/numpy.h>
-#include <screamer/common/buffer.h>
 #include "screamer/common/base.h"
-#include "screamer/common/float_info.h"
+#include "screamer/common/median_heaps.h"
+#include "screamer/common/sorted_windows.h"
 
 namespace py = pybind11;
 
 namespace screamer {
 
-    class RollingMedian : public ScreamerBase {
+    class RollingMedian : public ScreamerKernel<RollingMedian> {
     public:
 
         RollingMedian(int window_size) : 
             window_size(window_size), 
-            buffer(window_size, std::numeric_limits<double>::quiet_NaN()) 
+            index(0),
+            heaps(window_size)
         {
             if (window_size <= 0) {
                 throw std::invalid_argument("Window size must be positive.");
@@ -26,97 +27,60 @@ namespace screamer {
 
         void reset() override
         {
-            buffer.reset(std::numeric_limits<double>::quiet_NaN());
-            low.clear();
-            high.clear();
+            index = 0;
+            heaps.clear();
         }
         
-    private:
-
-        double process_scalar(double newValue) override 
+        double step(double newValue) 
         {
-            double oldValue = buffer.append(newValue);
-
-            if (!isnan2(oldValue)) {
-                remove(oldValue);
-            }
-
-            if (!isnan2(newValue)) {
-                add(newValue);
-            }
-
-            if (low.empty() && high.empty()) {
-                return std::numeric_limits<double>::quiet_NaN();
-            } else {
-                return getMedian();
+            // The new value replaces the oldest value in the ring buffer slot
+            heaps.replace(index, newValue);
+            index++;
+            if (index == window_size) {
+                index = 0;
             }
+            return heaps.median();
         }
 
-    private:
-        int window_size;
-        FixedSizeBuffer buffer;
-        std::multiset<double> low;  // Max heap (lower half)
-        std::multiset<double> high; // Min heap (upper half)
-
-        void add(double x)
+        // Arrays that span several windows are processed offline, sorting
+        // each block of window_size values once, see SortedWindows
+        template <typename T>
+        void array_no_stride(T* y, const T* x, size_t size)
         {
-            // Insert into appropriate half
-            if (low.empty() || x <= *low.rbegin()) {
-                low.insert(x);
-            } else {
-                high.insert(x);
-            }
-
-            // Rebalance the two halves
-            rebalance();
+            array_stride(y, 1, x, 1, size);
         }
 
-        void remove(double x)
+        template <typename T>
+        void array_stride(T* y, size_t dy, const T* x, size_t dx, size_t size)
         {
-            // Remove from the appropriate half
-            auto it = low.find(x);
-            if (it != low.end()) {
-                low.erase(it);
-            } else {
-                it = high.find(x);
-                if (it != high.end()) {
-                    high.erase(it);
-                }
+            // The heaps are as fast for windows that are not much larger
+            if (window_size < 256 || size < 4 * static_cast<size_t>(window_size)) {
+                ScreamerKernel::array_stride(y, dy, x, dx, size);
+                return;
             }
 
-            // Rebalance after removal
-            rebalance();
-        }
-
-        void rebalance()
-        {
-            // Ensure size properties: low.size() >= high.size()
-            if (low.size() > high.size() + 1) {
-                high.insert(*low.rbegin());
-                low.erase(--low.end());
-            } else if (high.size() > low.size()) {
-                low.insert(*high.begin());
-                high.erase(high.begin());
-            }
+            // The same values as MedianHeaps::median()
+            SortedWindows windows(window_size);
+            windows.run(y, dy, x, dx, size, [](SortedWindows& w) {
+                int n = w.count();
+                if (n == 0) {
+                    return std::numeric_limits<double>::quiet_NaN();
+                }
+                if (n % 2 == 1) {
+                    return w.kth(n / 2);
+                }
+                double low = w.kth(n / 2 - 1);
+                return (low + w.next()) / 2.0;
+            });
         }
 
-        double getMedian()
-        {
-            if (low.empty()) {
-                return std::numeric_limits<double>::quiet_NaN();
-            }
-
-            if (low.size() == high.size()) {
-                // Median is the average of max of low and min of high
-                return (*low.rbegin() + *high.begin()) / 2.0;
-            } else {
-                // Median is max of low
-                return *low.rbegin();
-            }
-        }
+    private:
+        int window_size;
+        int index;
+        MedianHeaps heaps;
     
     }; // end of class
 
 } // end of namespace
 
-#endif // end of include guards
\ No newline at end of file
+#endif // end of include guards
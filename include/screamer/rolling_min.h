@@ -1,23 +1,21 @@
-
 #ifndef SCREAMER_ROLLING_MIN_H
 #define SCREAMER_ROLLING_MIN_H
 
-#include <deque>
 #include <pybind11/pybind11.h>
 #include <pybind11/numpy.h>
-#include <screamer/common/buffer.h>
 #include "screamer/common/base.h"
+#include "screamer/common/sliding_extremes.h"
 
 namespace py = pybind11;
 
 namespace screamer {
 
-    class RollingMin : public ScreamerBase {
+    class RollingMin : public ScreamerKernel<RollingMin> {
     public:
 
         RollingMin(int window_size) : 
             window_size_(window_size), 
-            index(0)
+            queue(window_size)
         {
             if (window_size <= 0) {
                 throw std::invalid_argument("Window size must be positive.");
@@ -25,36 +23,38 @@ namespace screamer {
         }
 
         void reset() override {
-            min_deque.clear();
-            index = 0;    
+            queue.clear();
         }
         
-    private:
-
-        double process_scalar(double newValue) override {
-            // Remove elements from the back that are larger than the new value
-            while (!min_deque.empty() && min_deque.back().first >= newValue) {
-                min_deque.pop_back();
-            }
+        double step(double newValue) {
+            return queue.push(newValue);
+        }
 
-            // Add the new value and its index to the deque
-            min_deque.emplace_back(newValue, index);
+        // Arrays use the van Herk / Gil-Werman block algorithm
+        template <typename T>
+        void array_no_stride(T* y, const T* x, size_t size) {
+            array_stride(y, 1, x, 1, size);
+        }
 
-            // Remove the front element if it's outside the window
-            if (min_deque.front().second <= index - window_size_) {
-                min_deque.pop_front();
+        template <typename T>
+        void array_stride(T* y, size_t dy, const T* x, size_t dx, size_t size) {
+            if (has_nan(x, dx, size)) {
+                ScreamerKernel::array_stride(y, dy, x, dx, size);
+                return;
+            }
+            BlockExtremes<MinOrder> blocks(window_size_);
+            for (size_t start = 0; start < size; start += window_size_) {
+                int len = static_cast<int>(std::min<size_t>(window_size_, size - start));
+                const double* minimum = blocks.next_block(x + start * dx, dx, len);
+                for (int j = 0; j < len; j++) {
+                    y[(start + j) * dy] = static_cast<T>(minimum[j]);
+                }
             }
-
-            index++;
-
-            // The front of the deque contains the minimum value in the window
-            return min_deque.front().first;
         }
 
     private:
     const int window_size_;
-    int index; // Current index
-    std::deque<std::pair<double, int>> min_deque; // Stores pairs of (value, index)
+    MonotonicQueue<MinOrder> queue; // candidates for the minimum of the window
 
     }; // end of class
 
@@ -0,0 +1,111 @@
+#ifndef SCREAMER_ROLLING_MIN_MAX_H
+#define SCREAMER_ROLLING_MIN_MAX_H
+
+#include <pybind11/pybind11.h>
+#include <pybind11/numpy.h>
+#include "screamer/common/base.h"
+#include "screamer/common/sliding_extremes.h"
+
+namespace py = pybind11;
+
+namespace screamer {
+
+    // The minimum and the maximum of the window in one pass, the result has
+    // an extra last dimension with the minimum and the maximum
+    class RollingMinMax : public ScreamerKernel<RollingMinMax> {
+    public:
+
+        RollingMinMax(int window_size) :
+            min_queue(window_size),
+            max_queue(window_size)
+        {
+            if (window_size <= 0) {
+                throw std::invalid_argument("Window size must be positive.");
+            }
+        }
+
+        void reset() override {
+            min_queue.clear();
+            max_queue.clear();
+        }
+
+        size_t output_size() const override {
+            return 2;
+        }
+
+        double step(double newValue) {
+            max_queue.push(newValue);
+            return min_queue.push(newValue);
+        }
+
+        void process_scalar_multi(double newValue, double* results) override {
+            results[0] = min_queue.push(newValue);
+            results[1] = max_queue.push(newValue);
+        }
+
+    private:
+        MonotonicQueue<MinOrder> min_queue;
+        MonotonicQueue<MaxOrder> max_queue;
+
+    }; // end of class
+
+    // The maximum minus the minimum of the window
+    class RollingRange : public ScreamerKernel<RollingRange> {
+    public:
+
+        RollingRange(int window_size) :
+            window_size_(window_size),
+            min_queue(window_size),
+            max_queue(window_size)
+        {
+            if (window_size <= 0) {
+                throw std::invalid_argument("Window size must be positive.");
+            }
+        }
+
+        void reset() override {
+            min_queue.clear();
+            max_queue.clear();
+        }
+
+        double step(double newValue) {
+            double minimum = min_queue.push(newValue);
+            double maximum = max_queue.push(newValue);
+            return maximum - minimum;
+        }
+
+        // Arrays use the van Herk / Gil-Werman block algorithm, for the
+        // minimum and the maximum block by block
+        template <typename T>
+        void array_no_stride(T* y, const T* x, size_t size) {
+            array_stride(y, 1, x, 1, size);
+        }
+
+        template <typename T>
+        void array_stride(T* y, size_t dy, const T* x, size_t dx, size_t size) {
+            if (has_nan(x, dx, size)) {
+                ScreamerKernel::array_stride(y, dy, x, dx, size);
+                return;
+            }
+            BlockExtremes<MinOrder> min_blocks(window_size_);
+            BlockExtremes<MaxOrder> max_blocks(window_size_);
+            for (size_t start = 0; start < size; start += window_size_) {
+                int len = static_cast<int>(std::min<size_t>(window_size_, size - start));
+                const double* minimum = min_blocks.next_block(x + start * dx, dx, len);
+                const double* maximum = max_blocks.next_block(x + start * dx, dx, len);
+                for (int j = 0; j < len; j++) {
+                    y[(start + j) * dy] = static_cast<T>(maximum[j] - minimum[j]);
+                }
+            }
+        }
+
+    private:
+        const int window_size_;
+        MonotonicQueue<MinOrder> min_queue;
+        MonotonicQueue<MaxOrder> max_queue;
+
+    }; // end of class
+
+} // end of namespace
+
+#endif // end of include guards
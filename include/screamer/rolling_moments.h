@@ -0,0 +1,174 @@
+#ifndef SCREAMER_ROLLING_MOMENTS_H
+#define SCREAMER_ROLLING_MOMENTS_H
+
+#include <vector>
+#include <string>
+#include <limits>
+#include <cmath>
+#include <algorithm>
+#include <pybind11/pybind11.h>
+#include <pybind11/numpy.h>
+#include "screamer/common/base.h"
+#include "screamer/common/math.h"
+#include "screamer/detail/start_policy.h"
+#include "screamer/detail/moments.h"
+
+namespace py = pybind11;
+
+namespace screamer {
+
+    // Several moments of the same window: mean, var, std, skew and kurt, in
+    // the order of outputs. One ring buffer keeps the window values and the
+    // power sums are updated once per value, only up to the highest power the
+    // outputs need. The values are those of RollingMean, RollingVar,
+    // RollingStd, RollingSkew and RollingKurt with the same start policy.
+    class RollingMoments : public ScreamerKernel<RollingMoments> {
+    public:
+
+        RollingMoments(
+            int window_size,
+            const std::vector<std::string>& outputs = {"mean", "std", "skew", "kurt"},
+            const std::string& start_policy = "strict"
+        ) :
+            window_size_(window_size),
+            start_policy_(detail::parse_start_policy(start_policy)),
+            moments_(detail::parse_moments(outputs)),
+            power_(detail::moments_power(moments_)),
+            results_(moments_.size())
+        {
+            if (window_size_ <= 0) {
+                throw std::invalid_argument("Window size must be positive.");
+            }
+            for (detail::Moment moment : moments_) {
+                if ((moment == detail::Moment::Var || moment == detail::Moment::Std) && window_size_ < 2) {
+                    throw std::invalid_argument("Window size must be 2 or more.");
+                }
+                if (moment == detail::Moment::Skew && window_size_ <= 2) {
+                    throw std::invalid_argument("Window size must be 3 or more.");
+                }
+            }
+            values_.resize(window_size_);
+            reset();
+        }
+
+        void reset() override {
+            std::fill(values_.begin(), values_.end(), 0.0);
+            std::fill(sums_, sums_ + 4, 0.0);
+            index_ = 0;
+            count_ = 0;
+            n_ = (start_policy_ != detail::StartPolicy::Zero) ? 0 : window_size_;
+            n_consts();
+        }
+
+        size_t output_size() const override {
+            return moments_.size();
+        }
+
+        double step(double newValue) {
+            process_scalar_multi(newValue, results_.data());
+            return results_[0];
+        }
+
+        void process_scalar_multi(double newValue, double* results) override {
+            append(newValue);
+
+            if (count_ < window_size_ && start_policy_ == detail::StartPolicy::Strict) {
+                std::fill(results, results + moments_.size(), std::numeric_limits<double>::quiet_NaN());
+                return;
+            }
+
+            for (size_t j = 0; j < moments_.size(); j++) {
+                results[j] = moment(moments_[j]);
+            }
+        }
+
+    private:
+        const int window_size_;
+        const detail::StartPolicy start_policy_;
+        const std::vector<detail::Moment> moments_;
+        const int power_;                   // highest power in sums_
+        std::vector<double> results_;       // scratch for step()
+
+        std::vector<double> values_;        // ring buffer with the window
+        int index_;                         // ring index of the oldest value
+        int count_;                         // number of values seen, up to window_size_
+        double sums_[4];                    // sums of x, x^2, x^3 and x^4 over the window
+        int n_;                             // number of values the moments are over
+
+        double skew_c0;
+        double kurt_c0;
+        double kurt_c1;
+        double kurt_c2;
+
+        void n_consts() {
+            skew_n_const(n_, skew_c0);
+            kurt_n_const(n_, kurt_c0, kurt_c1, kurt_c2);
+        }
+
+        // Add a value to the window and the power sums, as detail::RollingSum
+        // does for each power
+        void append(double newValue) {
+            double oldValue = values_[index_];
+            values_[index_] = newValue;
+            index_++;
+            if (index_ == window_size_) {
+                index_ = 0;
+            }
+
+            double add[4];
+            powers(newValue, add);
+            if (count_ < window_size_) {
+                count_++;
+                if (start_policy_ != detail::StartPolicy::Zero) {
+                    n_++;
+                    n_consts();
+                }
+            } else {
+                double sub[4];
+                powers(oldValue, sub);
+                for (int k = 0; k < power_; k++) {
+                    add[k] -= sub[k];
+                }
+            }
+            for (int k = 0; k < power_; k++) {
+                sums_[k] += add[k];
+            }
+        }
+
+        // The first four powers of a value
+        void powers(double value, double* p) const {
+            double value2 = value * value;
+            p[0] = value;
+            p[1] = value2;
+            p[2] = value2 * value;
+            p[3] = value2 * value2;
+        }
+
+        double moment(detail::Moment moment) const {
+            double result = 0.0;
+            switch (moment) {
+                case detail::Moment::Mean:
+                    result = sums_[0] / n_;
+                    break;
+                case detail::Moment::Var:
+                    var_from_stats(sums_[0], sums_[1], n_, result);
+                    break;
+                case detail::Moment::Std:
+                    var_from_stats(sums_[0], sums_[1], n_, result);
+                    result = std::sqrt(result);
+                    break;
+                case detail::Moment::Skew:
+                    skew_from_stats(sums_[0], sums_[1], sums_[2], skew_c0, n_, result);
+                    break;
+                case detail::Moment::Kurt:
+                    kurt_from_stats(sums_[0], sums_[1], sums_[2], sums_[3], kurt_c0, kurt_c1, kurt_c2, n_, result);
+                    break;
+            }
+            return result;
+        }
+
+    }; // end of class
+
+} // end of namespace
+
+#endif // SCREAMER_ROLLING_MOMENTS_H
@@ -0,0 +1,240 @@
+#ifndef SCREAMER_ROLLING_OLS_H
+#define SCREAMER_ROLLING_OLS_H
+
+#include <vector>
+#include <string>
+#include <limits>
+#include <algorithm>
+#include <stdexcept>
+#include <Eigen/Dense>
+#include "screamer/common/regression.h"
+#include "screamer/common/float_info.h"
+#include "screamer/detail/cholesky.h"
+#include "screamer/detail/start_policy.h"
+
+namespace screamer {
+
+    // Rolling least squares regression of y on k factors over the last
+    // window_size rows.
+    //
+    // X'X and X'y of the window are updated per row by adding the new row
+    // and subtracting the row that leaves the window, and the Cholesky factor
+    // L of X'X by a rank one update and downdate, so a step costs O(p^2) for
+    // p coefficients instead of the O(p^3) of a new factorization. Every
+    // window_size rows, X'X and X'y are summed again from the rows in the
+    // window and refactored, which bounds the rounding errors of the updates
+    // at an amortized O(p^2 + p^3 / window_size).
+    //
+    // Rows with a NaN in x or y give NaN until they have left the window.
+    class RollingOLS : public ScreamerRegression {
+    public:
+
+        RollingOLS(
+            int window_size,
+            int k,
+            const std::string& output = "coef",
+            bool fit_intercept = true,
+            const std::string& start_policy = "strict"
+        ) :
+            ScreamerRegression(k, fit_intercept, output),
+            window_size_(window_size),
+            start_policy_(detail::parse_start_policy(start_policy)),
+            llt_(p_)
+        {
+            if (start_policy_ == detail::StartPolicy::Zero) {
+                throw std::invalid_argument("Start policy must be 'strict' or 'expanding'.");
+            }
+            if (window_size_ < p_) {
+                throw std::invalid_argument("Window size must be at least the number of coefficients.");
+            }
+            rows_.resize(static_cast<size_t>(window_size_) * p_);
+            ys_.resize(window_size_);
+            valid_.resize(window_size_);
+            xtx_.resize(p_ * p_);
+            xty_.resize(p_);
+            L_.resize(p_ * p_);
+            inv_diag_.resize(p_);
+            u_.resize(p_);
+            w_.resize(p_);
+            beta_.resize(p_);
+            reset();
+        }
+
+        void reset() override {
+            std::fill(rows_.begin(), rows_.end(), 0.0);
+            std::fill(ys_.begin(), ys_.end(), 0.0);
+            std::fill(valid_.begin(), valid_.end(), 0);
+            std::fill(xtx_.begin(), xtx_.end(), 0.0);
+            std::fill(xty_.begin(), xty_.end(), 0.0);
+            sum_y_ = 0.0;
+            sum_yy_ = 0.0;
+            index_ = 0;
+            count_ = 0;
+            nan_count_ = 0;
+            factor_ok_ = false;
+        }
+
+        void process_row(const double* x, double y, double* result) override {
+            double* row = &rows_[static_cast<size_t>(index_) * p_];
+
+            // the oldest row leaves the window, w_ keeps it for the downdate
+            bool remove = false;
+            if (count_ == window_size_) {
+                if (valid_[index_]) {
+                    remove = true;
+                    add_sums(row, ys_[index_], -1.0);
+                    std::copy(row, row + p_, w_.begin());
+                } else {
+                    nan_count_--;
+                }
+            } else {
+                count_++;
+            }
+
+            // the new row, with a leading 1 for the intercept
+            int offset = fit_intercept_ ? 1 : 0;
+            if (fit_intercept_) {
+                row[0] = 1.0;
+            }
+            bool valid = isfinite2(y);
+            for (int j = 0; j < k_; j++) {
+                row[offset + j] = x[j];
+                valid = valid && isfinite2(x[j]);
+            }
+            ys_[index_] = y;
+            valid_[index_] = valid;
+            if (valid) {
+                add_sums(row, y, 1.0);
+            } else {
+                nan_count_++;
+            }
+
+            if (factor_ok_) {
+                if (valid && remove) {
+                    std::copy(row, row + p_, u_.begin());
+                    factor_ok_ = detail::cholesky_rank_two(L_.data(), inv_diag_.data(), u_.data(), w_.data(), p_);
+                } else if (valid) {
+                    std::copy(row, row + p_, u_.begin());
+                    factor_ok_ = detail::cholesky_rank_one(L_.data(), inv_diag_.data(), u_.data(), p_, false);
+                } else if (remove) {
+                    factor_ok_ = detail::cholesky_rank_one(L_.data(), inv_diag_.data(), w_.data(), p_, true);
+                }
+            }
+
+            index_++;
+            if (index_ == window_size_) {
+                index_ = 0;
+                refresh();
+            }
+
+            if (!solve()) {
+                std::fill(result, result + output_size(), std::numeric_limits<double>::quiet_NaN());
+                return;
+            }
+
+            switch (output_) {
+                case Output::Coef:
+                    std::copy(beta_.begin(), beta_.end(), result);
+                    break;
+                case Output::Residual:
+                    result[0] = y - dot(row, beta_.data());
+                    break;
+                case Output::R2: {
+                    int n = count_ - nan_count_;
+                    double ssr = sum_yy_ - dot(beta_.data(), xty_.data());
+                    double sst = fit_intercept_ ? sum_yy_ - sum_y_ * sum_y_ / n : sum_yy_;
+                    result[0] = 1.0 - ssr / sst;
+                    break;
+                }
+            }
+        }
+
+    private:
+        const int window_size_;
+        const detail::StartPolicy start_policy_;
+
+        std::vector<double> rows_;          // ring buffer of rows, p values each
+        std::vector<double> ys_;            // ring buffer of y
+        std::vector<char> valid_;           // whether the row and y have no NaN
+        int index_;                         // ring index of the oldest row
+        int count_;                         // number of rows seen, up to window_size_
+        int nan_count_;                     // rows with NaN in the window
+
+        std::vector<double> xtx_;           // X'X of the valid rows, lower triangle, column-major
+        std::vector<double> xty_;           // X'y of the valid rows
+        double sum_y_;
+        double sum_yy_;
+
+        Eigen::LLT<Eigen::MatrixXd> llt_;   // for refactoring X'X
+        std::vector<double> L_;             // Cholesky factor of X'X, see detail/cholesky.h
+        std::vector<double> inv_diag_;      // reciprocals of the diagonal of L_
+        bool factor_ok_;                    // whether L_ is the factor of xtx_
+        std::vector<double> u_;             // scratch for the update with the new row
+        std::vector<double> w_;             // scratch for the downdate with the old row
+        std::vector<double> beta_;          // coefficients
+
+        double dot(const double* a, const double* b) const {
+            double sum = 0.0;
+            for (int j = 0; j < p_; j++) {
+                sum += a[j] * b[j];
+            }
+            return sum;
+        }
+
+        // Add a valid row to the sums, with sign -1 subtract it
+        void add_sums(const double* row, double y, double sign) {
+            for (int j = 0; j < p_; j++) {
+                double rj = sign * row[j];
+                double* col = &xtx_[j * p_];
+                for (int i = j; i < p_; i++) {
+                    col[i] += rj * row[i];
+                }
+                xty_[j] += rj * y;
+            }
+            sum_y_ += sign * y;
+            sum_yy_ += sign * y * y;
+        }
+
+        // Sum X'X and X'y again from the valid rows in the window
+        void refresh() {
+            std::fill(xtx_.begin(), xtx_.end(), 0.0);
+            std::fill(xty_.begin(), xty_.end(), 0.0);
+            sum_y_ = 0.0;
+            sum_yy_ = 0.0;
+            for (int i = 0; i < count_; i++) {
+                if (valid_[i]) {
+                    add_sums(&rows_[static_cast<size_t>(i) * p_], ys_[i], 1.0);
+                }
+            }
+            factor_ok_ = false;
+        }
+
+        // Solve X'X beta = X'y with the Cholesky factor, refactoring first if
+        // needed. Returns false if there is no result for the window.
+        bool solve() {
+            if (nan_count_ > 0 || count_ < p_) {
+                return false;
+            }
+            if (count_ < window_size_ && start_policy_ == detail::StartPolicy::Strict) {
+                return false;
+            }
+            if (!factor_ok_) {
+                // LLT only reads the lower triangle
+                llt_.compute(Eigen::Map<const Eigen::MatrixXd>(xtx_.data(), p_, p_));
+                if (llt_.info() != Eigen::Success) {
+                    return false;
+                }
+                Eigen::Map<Eigen::MatrixXd>(L_.data(), p_, p_) = llt_.matrixL();
+                detail::cholesky_inv_diag(L_.data(), inv_diag_.data(), p_);
+                factor_ok_ = true;
+            }
+            std::copy(xty_.begin(), xty_.end(), beta_.begin());
+            detail::cholesky_solve(L_.data(), inv_diag_.data(), beta_.data(), p_);
+            return true;
+        }
+
+    }; // end of class
+
+} // end of namespace
+
+#endif // SCREAMER_ROLLING_OLS_H
@@ -36,7 +36,7 @@ namespace py = pybind11;
 
 namespace screamer {
 
-    class RollingOU : public ScreamerBase {
+    class RollingOU : public ScreamerKernel<RollingOU> {
     public:
 
         RollingOU(
@@ -76,7 +76,7 @@ namespace screamer {
             sum_xy = 0;
         }
         
-        double process_scalar(double newValue) override {
+        double step(double newValue) {
             if ((n_ < window_size_) && (start_policy_ != detail::StartPolicy::Zero) ) {
                 n_++;
             }             
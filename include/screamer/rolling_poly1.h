@@ -46,7 +46,7 @@ Sxy` = Sxy - [y1 + y2 + ... + y(n-1)     ] + (n-1)*yn
 */
 namespace screamer {
 
-    class RollingPoly1 : public ScreamerBase {
+    class RollingPoly1 : public ScreamerKernel<RollingPoly1> {
     public:
         RollingPoly1(int window_size, int derivative_order = 0, const std::string& start_policy = "strict") : 
             window_size_(window_size),
@@ -81,7 +81,7 @@ namespace screamer {
             }
         }
 
-        double process_scalar(double yn) override {
+        double step(double yn) {
 
             double y0 = delay_buffer_.append(yn);
             sum_y += yn - y0;
@@ -127,7 +127,7 @@ namespace screamer {
             c = Sy / n - b * Sx / n - a * Sx2 / n;            
     }
 
-    class RollingPoly2 : public ScreamerBase {
+    class RollingPoly2 : public ScreamerKernel<RollingPoly2> {
     public:
         RollingPoly2(int window_size, int derivative_order = 0, const std::string& start_policy = "strict") : 
             window_size_(window_size),
@@ -174,7 +174,7 @@ namespace screamer {
 
         }
 
-        double process_scalar(double yn) override {
+        double step(double yn) {
 
             double y0 = delay_buffer_.append(yn);
             sum_y += yn - y0;
@@ -226,7 +226,6 @@ namespace screamer {
                 Zxx, Zxx2, Zx2x2, d,
                 a, b, c
             );
-            std::cout << "a=" << a << " b=" << b << " c=" << c << std::endl;
 
             // Calculating endpoint, slope, and curvature based on derivative_order_
             double endpoint = a * (n_ - 1) * (n_ - 1) + b * (n_ - 1) + c;
@@ -0,0 +1,43 @@
+#ifndef SCREAMER_ROLLING_PROD_H
+#define SCREAMER_ROLLING_PROD_H
+
+#include <pybind11/pybind11.h>
+#include <pybind11/numpy.h>
+#include "screamer/common/base.h"
+#include "screamer/common/sliding_aggregator.h"
+
+namespace py = pybind11;
+
+namespace screamer {
+
+    struct ProdMonoid {
+        using value_type = double;
+        static double combine(double older, double newer) { return older * newer; }
+    };
+
+    // Product of the values in the window, computed from the values in the
+    // window instead of dividing out the oldest value, so zeros leave the
+    // window without trouble
+    class RollingProd : public ScreamerKernel<RollingProd> {
+    public:
+
+        RollingProd(int window_size) :
+            aggregator(window_size)
+        {}
+
+        void reset() override {
+            aggregator.clear();
+        }
+
+        double step(double newValue) {
+            return aggregator.push(newValue);
+        }
+
+    private:
+        SlidingAggregator<ProdMonoid> aggregator;
+
+    }; // end of class
+
+} // end of namespace
+
+#endif // end of include guards
@@ -2,46 +2,123 @@
 #define SCREAMER_ROLLING_QUANTILE_H
 
 #include <deque>
+#include <vector>
 #include <pybind11/pybind11.h>
 #include <pybind11/numpy.h>
 #include "screamer/common/buffer.h"
 #include "screamer/common/base.h"
-#include "common/order_statistic_tree.h"
+#include "screamer/common/sorted_blocks.h"
+#include "screamer/common/sorted_windows.h"
 #include "screamer/common/float_info.h"
 
 namespace py = pybind11;
 
 namespace screamer {
 
-    class RollingQuantile : public ScreamerBase {
+    class RollingQuantile : public ScreamerKernel<RollingQuantile> {
     public:
 
         RollingQuantile(int window_size, double quantile) :
-            window_size(window_size),
-            quantile(quantile),
-            buffer(window_size, -1), // std::numeric_limits<double>::quiet_NaN()
-            ost(window_size)
+            RollingQuantile(window_size, std::vector<double>{quantile}, false)
+        {}
+
+        // Several quantiles of the same window, computed from one shared
+        // sorted window. The result has an extra last dimension with one
+        // value per quantile.
+        RollingQuantile(int window_size, const std::vector<double>& quantiles) :
+            RollingQuantile(window_size, quantiles, true)
+        {}
+
+        void reset() override
         {
-            if (window_size <= 0) {
-                throw std::invalid_argument("Window size must be positive.");
+            buffer.reset(std::numeric_limits<double>::quiet_NaN());
+            ost.clear();
+        }
+
+        size_t output_size() const override
+        {
+            return multi_output ? quantiles.size() : 0;
+        }
+
+        double step(double newValue)
+        {
+            if (!append(newValue)) {
+                return std::numeric_limits<double>::quiet_NaN();
             }
-            if (quantile < 0.0 || quantile > 1.0) {
-                throw std::invalid_argument("Quantile must be between 0 and 1.");
+            return getQuantile(quantiles[0]);
+        }
+
+        void process_scalar_multi(double newValue, double* results) override
+        {
+            if (!append(newValue)) {
+                std::fill(results, results + quantiles.size(), std::numeric_limits<double>::quiet_NaN());
+                return;
             }
+            for (size_t j = 0; j < quantiles.size(); j++) {
+                results[j] = getQuantile(quantiles[j]);
+            }
+        }
 
-            double key = 0.5;
-            double nanValue = std::numeric_limits<double>::quiet_NaN();     
+        // Arrays that span several windows are processed offline, sorting
+        // each block of window_size values once, see SortedWindows
+        template <typename T>
+        void array_no_stride(T* y, const T* x, size_t size)
+        {
+            array_stride(y, 1, x, 1, size);
         }
 
-        void reset() override
+        template <typename T>
+        void array_stride(T* y, size_t dy, const T* x, size_t dx, size_t size)
         {
-            buffer.reset(std::numeric_limits<double>::quiet_NaN());
-            ost.clear();
+            // Tiny windows are as fast streaming
+            if (window_size < 8 || size < 4 * static_cast<size_t>(window_size)) {
+                ScreamerKernel::array_stride(y, dy, x, dx, size);
+                return;
+            }
+
+            SortedWindows windows(window_size);
+            double quantile = quantiles[0];
+            windows.run(y, dy, x, dx, size, [&](SortedWindows& w) {
+                if (w.count() < window_size) {
+                    return std::numeric_limits<double>::quiet_NaN();
+                }
+                return interpolate(
+                    quantile, w.count(),
+                    [&](int k) { return w.kth(k); },
+                    [&](int) { return w.next(); }
+                );
+            });
         }
 
     private:
+        int window_size;
+        std::vector<double> quantiles;
+        bool multi_output;
+        FixedSizeBuffer buffer;
+        SortedBlocks ost;
 
-        double process_scalar(double newValue) override
+        RollingQuantile(int window_size, const std::vector<double>& quantiles, bool multi_output) :
+            window_size(window_size),
+            quantiles(quantiles),
+            multi_output(multi_output),
+            buffer(window_size, std::numeric_limits<double>::quiet_NaN()),
+            ost(window_size)
+        {
+            if (window_size <= 0) {
+                throw std::invalid_argument("Window size must be positive.");
+            }
+            if (quantiles.empty()) {
+                throw std::invalid_argument("At least one quantile is required.");
+            }
+            for (double quantile : quantiles) {
+                if (quantile < 0.0 || quantile > 1.0) {
+                    throw std::invalid_argument("Quantile must be between 0 and 1.");
+                }
+            }
+        }
+
+        // Add a new value to the window, returns true if the window is full
+        bool append(double newValue)
         {
             double oldValue = buffer.append(newValue);
 
@@ -53,19 +130,9 @@ namespace screamer {
                 add(newValue);
             }
 
-            if (ost.size() < window_size) {
-                return -2; //  std::numeric_limits<double>::quiet_NaN()
-            } else {
-                return getQuantile();
-            }
+            return ost.size() >= window_size;
         }
 
-    private:
-        int window_size;
-        double quantile;
-        FixedSizeBuffer buffer;
-        OrderStatisticTree ost;
-
         void add(double x)
         {
             ost.insert(x);
@@ -76,22 +143,30 @@ namespace screamer {
             ost.erase(x);
         }
 
-        double getQuantile()
+        double getQuantile(double quantile)
         {
             if (ost.size() == 0) {
-                return -3; //std::numeric_limits<double>::quiet_NaN();
+                return std::numeric_limits<double>::quiet_NaN();
             }
 
-            int n = ost.size();
+            auto kth = [&](int k) { return ost.kth_element(k); };
+            return interpolate(quantile, ost.size(), kth, kth);
+        }
+
+        // Interpolate between the values at the ranks around quantile * (n - 1),
+        // kth(k) is the value at rank k and next(k) at rank k right after kth(k - 1)
+        template <typename Kth, typename Next>
+        static double interpolate(double quantile, int n, Kth kth, Next next)
+        {
             double pos = quantile * (n - 1);
             int index = static_cast<int>(std::floor(pos));
             double fraction = pos - index;
 
-            double lower = ost.kth_element(index);
+            double lower = kth(index);
             double upper = lower;
 
             if (fraction > 0.0 && index + 1 < n) {
-                upper = ost.kth_element(index + 1);
+                upper = next(index + 1);
             }
 
             return lower + fraction * (upper - lower);
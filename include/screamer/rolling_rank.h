@@ -0,0 +1,74 @@
+#ifndef SCREAMER_ROLLING_RANK_H
+#define SCREAMER_ROLLING_RANK_H
+
+#include <limits>
+#include <pybind11/pybind11.h>
+#include <pybind11/numpy.h>
+#include "screamer/common/buffer.h"
+#include "screamer/common/base.h"
+#include "screamer/common/sorted_blocks.h"
+#include "screamer/common/float_info.h"
+
+namespace py = pybind11;
+
+namespace screamer {
+
+    // Rank of the newest value within the window, equal values get their
+    // average rank
+    class RollingRank : public ScreamerKernel<RollingRank> {
+    public:
+
+        RollingRank(int window_size, bool normalize = true) :
+            window_size(window_size),
+            normalize(normalize),
+            buffer(window_size, std::numeric_limits<double>::quiet_NaN()),
+            window(window_size)
+        {
+            if (window_size <= 0) {
+                throw std::invalid_argument("Window size must be positive.");
+            }
+        }
+
+        void reset() override
+        {
+            buffer.reset(std::numeric_limits<double>::quiet_NaN());
+            window.clear();
+        }
+
+        double step(double newValue)
+        {
+            double oldValue = buffer.append(newValue);
+            if (!isnan2(oldValue)) {
+                window.erase(oldValue);
+            }
+            if (isnan2(newValue)) {
+                return std::numeric_limits<double>::quiet_NaN();
+            }
+            window.insert(newValue);
+
+            // Like RollingQuantile, windows with NaN give NaN
+            if (window.size() < window_size) {
+                return std::numeric_limits<double>::quiet_NaN();
+            }
+
+            // Ranks start at 1, ties share the average of their ranks
+            int less = window.rank(newValue);
+            int less_equal = window.upper_rank(newValue);
+            double rank = less + (less_equal - less + 1) / 2.0;
+            if (normalize) {
+                return rank / window_size;
+            }
+            return rank;
+        }
+
+    private:
+        int window_size;
+        bool normalize;
+        FixedSizeBuffer buffer;
+        SortedBlocks window;    // the non-NaN values of the window
+
+    }; // end of class
+
+} // end of namespace
+
+#endif // end of include guards
@@ -15,7 +15,7 @@ namespace py = pybind11;
 
 namespace screamer {
 
-    class RollingRms : public ScreamerBase {
+    class RollingRms : public ScreamerKernel<RollingRms> {
     public:
 
         RollingRms(int window_size, const std::string& start_policy = "strict") : 
@@ -35,7 +35,7 @@ namespace screamer {
             n_ = (start_policy_ != detail::StartPolicy::Zero) ? 0 : window_size_;
         }
         
-        double process_scalar(double newValue) override {
+        double step(double newValue) {
             if ((n_ < window_size_) && (start_policy_ != detail::StartPolicy::Zero) ) {
                 n_++;
             } 
@@ -51,7 +51,7 @@ namespace screamer {
             size_t split = std::min<int>(size, window_size_);
 
             for (size_t i=0; i<split; i++) {
-                y[i] = process_scalar(x[i]);
+                y[i] = step(x[i]);
                 sum_xx += x[i] * x[i];
             }
             
@@ -61,6 +61,56 @@ namespace screamer {
             }
 
         }
+        bool has_panel_kernel() const override { return true; }
+
+        void process_array_panel(double* y, size_t dy, const double* x, size_t dx, size_t rows, size_t cols) const override {
+            const size_t window_size = window_size_;
+            const double nan = std::numeric_limits<double>::quiet_NaN();
+
+            size_t split = std::min(rows, window_size);
+
+            // Per-column running sums of squares of one tile of columns
+            std::vector<double> sum(panel_tile_cols);
+
+            for (size_t c0 = 0; c0 < cols; c0 += panel_tile_cols) {
+                const size_t nc = std::min(panel_tile_cols, cols - c0);
+                std::fill(sum.begin(), sum.begin() + nc, 0.0);
+                double* s = sum.data();
+
+                // Start period, same policies as step
+                for (size_t r = 0; r < split; ++r) {
+                    const double* xr = x + r * dx + c0;
+                    double* yr = y + r * dy + c0;
+
+                    for (size_t c = 0; c < nc; ++c) {
+                        s[c] += xr[c] * xr[c];
+                    }
+
+                    if ((r + 1 < window_size) && (start_policy_ == detail::StartPolicy::Strict)) {
+                        std::fill(yr, yr + nc, nan);
+                        continue;
+                    }
+                    const double n = (start_policy_ == detail::StartPolicy::Zero) ? window_size : r + 1;
+
+                    for (size_t c = 0; c < nc; ++c) {
+                        yr[c] = std::sqrt(s[c] / n);
+                    }
+                }
+
+                // Full windows, add the new row and remove the row that left the window
+                for (size_t r = split; r < rows; ++r) {
+                    const double* xr = x + r * dx + c0;
+                    const double* xo = x + (r - window_size) * dx + c0;
+                    double* yr = y + r * dy + c0;
+
+                    for (size_t c = 0; c < nc; ++c) {
+                        s[c] += xr[c] * xr[c] - xo[c] * xo[c];
+                        yr[c] = std::sqrt(s[c] / window_size);
+                    }
+                }
+            }
+        }
+
     private:
         const int window_size_;
         const detail::StartPolicy start_policy_;
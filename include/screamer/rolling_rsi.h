@@ -12,7 +12,7 @@ namespace py = pybind11;
 
 namespace screamer {
 
-    class RollingRSI : public ScreamerBase {
+    class RollingRSI : public ScreamerKernel<RollingRSI> {
     public:
 
         RollingRSI(int window_size, const std::string& start_policy = "strict") : 
@@ -35,7 +35,7 @@ namespace screamer {
             n_ = (start_policy_ != detail::StartPolicy::Zero) ? 0 : window_size_;
         }
 
-        double process_scalar(double x) override {
+        double step(double x) {
             double dx = x - prev_x;
             prev_x = x;
 
@@ -12,7 +12,7 @@ namespace py = pybind11;
 
 namespace screamer {
 
-    class RollingSigmaClip : public ScreamerBase {
+    class RollingSigmaClip : public ScreamerKernel<RollingSigmaClip> {
     public:
 
         RollingSigmaClip(
@@ -78,7 +78,7 @@ namespace screamer {
             );
         }
 
-        double process_scalar(double newValue) override {
+        double step(double newValue) {
 
             double zscore, clippedValue;
 
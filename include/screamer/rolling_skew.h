@@ -5,6 +5,7 @@
 #include <pybind11/pybind11.h>
 #include <pybind11/numpy.h>
 #include "screamer/common/base.h"
+#include "screamer/common/window_sums.h"
 #include "screamer/common/math.h"
 #include "screamer/detail/rolling_sum.h"
 
@@ -13,7 +14,7 @@ namespace py = pybind11;
 namespace screamer {
 
 
-    class RollingSkew : public ScreamerBase {
+    class RollingSkew : public ScreamerKernel<RollingSkew> {
     public:
 
         RollingSkew(
@@ -41,9 +42,7 @@ namespace screamer {
             skew_n_const(n_, c0);
         }
         
-    private:
-
-        double process_scalar(double newValue) override {
+        double step(double newValue) {
             if ((n_ < window_size_) && (start_policy_ != detail::StartPolicy::Zero) ) {
                 n_++;
                 skew_n_const(n_, c0);
@@ -60,6 +59,24 @@ namespace screamer {
             return skew;
         }
 
+        // Arrays sum the windows with WindowSums, see window_sums_apply()
+        template <typename T>
+        void array_no_stride(T* y, const T* x, size_t size) {
+            array_stride(y, 1, x, 1, size);
+        }
+
+        template <typename T>
+        void array_stride(T* y, size_t dy, const T* x, size_t dx, size_t size) {
+            const int n = window_size_;
+            double c;
+            skew_n_const(n, c);
+            window_sums_apply<3>(*this, window_size_, y, dy, x, dx, size, [n, c](const double* s, size_t) {
+                double skew;
+                skew_from_stats(s[0], s[1], s[2], c, n, skew);
+                return skew;
+            });
+        }
+
     private:
         const int window_size_;
         const detail::StartPolicy start_policy_;
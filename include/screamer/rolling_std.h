@@ -6,6 +6,7 @@
 #include <pybind11/numpy.h>
 #include <screamer/detail/rolling_sum.h>
 #include "screamer/common/base.h"
+#include "screamer/common/window_sums.h"
 #include "screamer/common/math.h"
 /*
 todo: this implementation might  suffer from numerical instability
@@ -15,7 +16,7 @@ namespace py = pybind11;
 
 namespace screamer {
 
-    class RollingStd : public ScreamerBase {
+    class RollingStd : public ScreamerKernel<RollingStd> {
     public:
 
         RollingStd(int window_size, const std::string& start_policy = "strict") : 
@@ -37,7 +38,7 @@ namespace screamer {
             n_ = (start_policy_ != detail::StartPolicy::Zero) ? 0 : window_size_;
         }
         
-        double process_scalar(double newValue) override {
+        double step(double newValue) {
             if ((n_ < window_size_) && (start_policy_ != detail::StartPolicy::Zero) ) {
                 n_++;
             } 
@@ -50,26 +51,20 @@ namespace screamer {
             return std::sqrt(var);
         }
 
-        void process_array_no_stride(double* y, const double* x, size_t size) override {
-
-            double sum_x = 0.0;
-            double sum_xx = 0.0;
-
-            size_t split = std::min<int>(size, window_size_);
-
-            for (size_t i=0; i<split; i++) {
-                y[i] = process_scalar(x[i]);
-                sum_x += x[i];
-                sum_xx += x[i] * x[i];
-            }
-            
-            for (size_t i=split; i<size; i++) {
-                sum_x = sum_x + x[i] - x[i - window_size_];
-                sum_xx = sum_xx + x[i] * x[i] - x[i - window_size_] * x[i - window_size_];
-                double var = (sum_xx - sum_x * sum_x / window_size_) / (window_size_ - 1);
-                y[i] = std::sqrt(var);      
-            }
+        // Arrays sum the windows with WindowSums, see window_sums_apply()
+        template <typename T>
+        void array_no_stride(T* y, const T* x, size_t size) {
+            array_stride(y, 1, x, 1, size);
+        }
 
+        template <typename T>
+        void array_stride(T* y, size_t dy, const T* x, size_t dx, size_t size) {
+            const int n = window_size_;
+            window_sums_apply<2>(*this, window_size_, y, dy, x, dx, size, [n](const double* s, size_t) {
+                double var;
+                var_from_stats(s[0], s[1], n, var);
+                return std::sqrt(var);
+            });
         }
     private:
         const int window_size_;
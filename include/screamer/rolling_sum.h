@@ -11,7 +11,7 @@ namespace py = pybind11;
 
 namespace screamer {
 
-    class RollingSum : public ScreamerBase {
+    class RollingSum : public ScreamerKernel<RollingSum> {
     public:
 
         RollingSum(int window_size, const std::string& start_policy = "strict") : 
@@ -23,7 +23,7 @@ namespace screamer {
             rolling_sum_.reset();
         }
         
-        double process_scalar(double newValue) override {
+        double step(double newValue) {
             return rolling_sum_.append(newValue);        
         }
 
@@ -57,6 +57,53 @@ namespace screamer {
            
         }
 
+        bool has_panel_kernel() const override { return true; }
+
+        void process_array_panel(double* y, size_t dy, const double* x, size_t dx, size_t rows, size_t cols) const override {
+            const size_t window_size_ = rolling_sum_.capacity();
+            const detail::StartPolicy start_policy_ = rolling_sum_.start_policy();
+            const double nan = std::numeric_limits<double>::quiet_NaN();
+
+            size_t split = std::min(rows, window_size_);
+
+            // Per-column running sums of one tile of columns
+            std::vector<double> sum(panel_tile_cols);
+
+            for (size_t c0 = 0; c0 < cols; c0 += panel_tile_cols) {
+                const size_t nc = std::min(panel_tile_cols, cols - c0);
+                std::fill(sum.begin(), sum.begin() + nc, 0.0);
+                double* s = sum.data();
+
+                // Start period, same policies as detail::RollingSum
+                for (size_t r = 0; r < split; ++r) {
+                    const double* xr = x + r * dx + c0;
+                    double* yr = y + r * dy + c0;
+
+                    for (size_t c = 0; c < nc; ++c) {
+                        s[c] += xr[c];
+                    }
+
+                    if ((r + 1 < window_size_) && (start_policy_ == detail::StartPolicy::Strict)) {
+                        std::fill(yr, yr + nc, nan);
+                    } else {
+                        std::copy(s, s + nc, yr);
+                    }
+                }
+
+                // Full windows, add the new row and remove the row that left the window
+                for (size_t r = split; r < rows; ++r) {
+                    const double* xr = x + r * dx + c0;
+                    const double* xo = x + (r - window_size_) * dx + c0;
+                    double* yr = y + r * dy + c0;
+
+                    for (size_t c = 0; c < nc; ++c) {
+                        s[c] += xr[c] - xo[c];
+                        yr[c] = s[c];
+                    }
+                }
+            }
+        }
+
     private:
         screamer::detail::RollingSum rolling_sum_;
 
@@ -0,0 +1,38 @@
+#ifndef SCREAMER_ROLLING_SUM_BANK_H
+#define SCREAMER_ROLLING_SUM_BANK_H
+
+#include <limits>
+#include <algorithm>
+#include "screamer/common/bank.h"
+#include "screamer/detail/rolling_sum_bank.h"
+
+namespace screamer {
+
+    // RollingSum of n series at once, see ScreamerBank
+    class RollingSumBank : public ScreamerBank {
+    public:
+        RollingSumBank(int n, int window_size, const std::string& start_policy = "strict") :
+            ScreamerBank(n),
+            rolling_sum_(n, window_size, start_policy)
+        {}
+
+        void reset() override {
+            rolling_sum_.reset();
+        }
+
+        void process_row(double* y, const double* x) override {
+            const double* sum = rolling_sum_.append(x);
+            if (!sum) {
+                std::fill(y, y + n_, std::numeric_limits<double>::quiet_NaN());
+                return;
+            }
+            std::copy(sum, sum + n_, y);
+        }
+
+    private:
+        detail::RollingSumBank rolling_sum_;
+    };
+
+} // namespace screamer
+
+#endif // SCREAMER_ROLLING_SUM_BANK_H
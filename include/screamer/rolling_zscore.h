@@ -6,6 +6,8 @@
 #include <pybind11/numpy.h>
 #include <screamer/detail/rolling_sum.h>
 #include "screamer/common/base.h"
+#include "screamer/common/math.h"
+#include "screamer/common/window_sums.h"
 
 /*
 todo: this implementation might  suffer from numerical instability
@@ -15,7 +17,7 @@ namespace py = pybind11;
 
 namespace screamer {
 
-    class RollingZscore : public ScreamerBase {
+    class RollingZscore : public ScreamerKernel<RollingZscore> {
     public:
 
         RollingZscore(int window_size, const std::string& start_policy = "strict") : 
@@ -41,7 +43,7 @@ namespace screamer {
 
         }
         
-        double process_scalar(double newValue) override {
+        double step(double newValue) {
             if ((n_ < window_size_) && (start_policy_ != detail::StartPolicy::Zero) ) {
                 n_++;
                 c0 = 1.0 / (n_ * (n_ - 1));
@@ -55,33 +57,21 @@ namespace screamer {
             return zscore;
         }
 
-        void process_array_no_stride(double* y, const double* x, size_t size) override {
-
-            size_t window_size_ = this->window_size_;
-            double sum_x = 0.0;
-            double sum_xx = 0.0;
-
-            size_t split = std::min(size, window_size_);
-
-            for (size_t i=0; i<split; i++) {
-                y[i] = process_scalar(x[i]);
-                sum_x += x[i];
-                sum_xx += x[i] * x[i];
-            }
-            
-            for (size_t i=split; i<size; i++) {
-                sum_x = sum_x + x[i] - x[i - window_size_];
-                sum_xx = sum_xx + x[i] * x[i] - x[i - window_size_] * x[i - window_size_];
-                double var = (window_size_ * sum_xx - sum_x * sum_x) * c0;
-                double mean = sum_x / n_;
-                double std = std::sqrt(var);
-                double zscore = (x[i] - mean) / std;
-                y[i] = zscore;
-            }
-
-            // NaNs caused by DOF for all start policies
-            y[0] = std::numeric_limits<double>::quiet_NaN(); // y size will be at least 2 
+        // Arrays sum the windows with WindowSums, see window_sums_apply()
+        template <typename T>
+        void array_no_stride(T* y, const T* x, size_t size) {
+            array_stride(y, 1, x, 1, size);
+        }
 
+        template <typename T>
+        void array_stride(T* y, size_t dy, const T* x, size_t dx, size_t size) {
+            const double n = window_size_;
+            const double c = 1.0 / (n * (n - 1));
+            window_sums_apply<2>(*this, window_size_, y, dy, x, dx, size, [=](const double* s, size_t i) {
+                double var = (n * s[1] - s[0] * s[0]) * c;
+                double mean = s[0] / n;
+                return (static_cast<double>(x[i * dx]) - mean) / std::sqrt(var);
+            });
         }
     private:
         const int window_size_;
@@ -0,0 +1,72 @@
+#ifndef SCREAMER_ROLLING_ZSCORE_BANK_H
+#define SCREAMER_ROLLING_ZSCORE_BANK_H
+
+#include <cmath>
+#include <limits>
+#include <vector>
+#include <stdexcept>
+#include <algorithm>
+#include "screamer/common/bank.h"
+#include "screamer/detail/rolling_sum_bank.h"
+
+namespace screamer {
+
+    // RollingZscore of n series at once, see ScreamerBank
+    //
+    // There is no start_policy: like RollingZscore with any start policy, the
+    // result is NaN until the window is full.
+    class RollingZscoreBank : public ScreamerBank {
+    public:
+        RollingZscoreBank(int n, int window_size) :
+            ScreamerBank(n),
+            window_size_(checked_size(window_size)),
+            sum_y_(n, window_size),
+            sum_y2_(n, window_size),
+            y2_(n),
+            c0_(1.0 / (static_cast<double>(window_size) * (window_size - 1)))
+        {}
+
+        void reset() override {
+            sum_y_.reset();
+            sum_y2_.reset();
+        }
+
+        void process_row(double* y, const double* x) override {
+            for (size_t c = 0; c < n_; ++c) {
+                y2_[c] = x[c] * x[c];
+            }
+            const double* sum_y = sum_y_.append(x);
+            const double* sum_y2 = sum_y2_.append(y2_.data());
+
+            // Like RollingZscore, the sums are NaN until the window is full
+            if (!sum_y) {
+                std::fill(y, y + n_, std::numeric_limits<double>::quiet_NaN());
+                return;
+            }
+
+            const double w = window_size_;
+            for (size_t c = 0; c < n_; ++c) {
+                double var = (w * sum_y2[c] - sum_y[c] * sum_y[c]) * c0_;
+                double mean = sum_y[c] / w;
+                y[c] = (x[c] - mean) / std::sqrt(var);
+            }
+        }
+
+    private:
+        const size_t window_size_;
+        detail::RollingSumBank sum_y_;
+        detail::RollingSumBank sum_y2_;
+        std::vector<double> y2_;
+        const double c0_;
+
+        static int checked_size(int window_size) {
+            if (window_size < 2) {
+                throw std::invalid_argument("Window size must be 2 or more.");
+            }
+            return window_size;
+        }
+    };
+
+} // namespace screamer
+
+#endif // SCREAMER_ROLLING_ZSCORE_BANK_H
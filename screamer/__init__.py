@@ -4,9 +4,9 @@
 __version__ = "Unreleased"
 
 from .screamer_bindings import (
-    Abs, Butter, Clip, Diff, Elu, Erf, Erfc, EwKurt, EwMean, EwRms, EwSkew, EwStd, EwVar, EwZscore, Exp, Ffill, FillNa, Lag, Linear, Log, LogReturn, Power, Relu, Return, RollingFracDiff, RollingKurt, RollingMax, RollingMean, RollingMedian, RollingMin, RollingOU, RollingPoly1, RollingPoly2, RollingQuantile, RollingRSI, RollingRms, RollingSigmaClip, RollingSkew, RollingStd, RollingSum, RollingVar, RollingZscore, Selu, Sigmoid, Sign, Softsign, Sqrt, Tanh
+    Abs, Butter, Clip, Diff, Elu, Erf, Erfc, EwCorr, EwCov, EwKurt, EwMean, EwMeanBank, EwMoments, EwRLS, EwRms, EwSkew, EwStd, EwStdBank, EwVar, EwVarBank, EwZscore, Exp, Ffill, FillNa, Lag, Linear, Log, LogReturn, P2Quantile, Pipeline, Power, Relu, Return, RollingAll, RollingAny, RollingApproxQuantile, RollingArgMax, RollingArgMin, RollingBeta, RollingCorr, RollingCov, RollingFracDiff, RollingHampel, RollingKurt, RollingMAD, RollingMax, RollingMaxAbs, RollingMean, RollingMeanBank, RollingMedian, RollingMin, RollingMinMax, RollingMoments, RollingOLS, RollingOU, RollingPoly1, RollingPoly2, RollingProd, RollingQuantile, RollingRSI, RollingRange, RollingRank, RollingRms, RollingSigmaClip, RollingSkew, RollingStd, RollingSum, RollingSumBank, RollingVar, RollingZscore, RollingZscoreBank, Selu, Sigmoid, Sign, Softsign, Sqrt, Tanh
 )
 
 __all__ = [
-    "Abs", "Butter", "Clip", "Diff", "Elu", "Erf", "Erfc", "EwKurt", "EwMean", "EwRms", "EwSkew", "EwStd", "EwVar", "EwZscore", "Exp", "Ffill", "FillNa", "Lag", "Linear", "Log", "LogReturn", "Power", "Relu", "Return", "RollingFracDiff", "RollingKurt", "RollingMax", "RollingMean", "RollingMedian", "RollingMin", "RollingOU", "RollingPoly1", "RollingPoly2", "RollingQuantile", "RollingRms", "RollingSigmaClip", "RollingSkew", "RollingStd", "RollingSum", "RollingVar", "RollingZscore", "Selu", "Sigmoid", "Sign", "Softsign", "Sqrt", "Tanh"
+    "Abs", "Butter", "Clip", "Diff", "Elu", "Erf", "Erfc", "EwCorr", "EwCov", "EwKurt", "EwMean", "EwMeanBank", "EwMoments", "EwRLS", "EwRms", "EwSkew", "EwStd", "EwStdBank", "EwVar", "EwVarBank", "EwZscore", "Exp", "Ffill", "FillNa", "Lag", "Linear", "Log", "LogReturn", "P2Quantile", "Pipeline", "Power", "Relu", "Return", "RollingAll", "RollingAny", "RollingApproxQuantile", "RollingArgMax", "RollingArgMin", "RollingBeta", "RollingCorr", "RollingCov", "RollingFracDiff", "RollingHampel", "RollingKurt", "RollingMAD", "RollingMax", "RollingMaxAbs", "RollingMean", "RollingMeanBank", "RollingMedian", "RollingMin", "RollingMinMax", "RollingMoments", "RollingOLS", "RollingOU", "RollingPoly1", "RollingPoly2", "RollingProd", "RollingQuantile", "RollingRSI", "RollingRange", "RollingRank", "RollingRms", "RollingSigmaClip", "RollingSkew", "RollingStd", "RollingSum", "RollingSumBank", "RollingVar", "RollingZscore", "RollingZscoreBank", "Selu", "Sigmoid", "Sign", "Softsign", "Sqrt", "Tanh"
 ]
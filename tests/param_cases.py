@@ -14,11 +14,20 @@ screamer_module = sii.load_screamer_module()
 # List of all screamer class names
 screamer_classes = [cls for cls in dir(screamer_module) if  cls[0].isupper()]
 
-# The Rolling classes, except 'RollingQuantile' which has an extra argument
-rolling_classes = [cls for cls in screamer_classes if cls.startswith('Rolling') and not cls=='RollingQuantile' and not cls=='RollingFracDiff']
+# Banks process many series at once and have their own tests
+bank_classes = [cls for cls in screamer_classes if cls.endswith('Bank')]
+screamer_classes = [cls for cls in screamer_classes if cls not in bank_classes]
 
-# The Ew classes, except: todo baselines for 'EwSkew', 'EwKurt'
-ew_classes = [cls for cls in screamer_classes if cls.startswith('Ew') and not cls in['EwSkew', 'EwKurt']]
+# The Rolling classes, except the quantiles which have an extra argument,
+# RollingMinMax and RollingMoments which have several outputs and their own tests,
+# the two-input classes RollingCov, RollingCorr and RollingBeta, and the
+# regression RollingOLS
+rolling_classes = [cls for cls in screamer_classes if cls.startswith('Rolling') and not cls in ['RollingQuantile', 'RollingApproxQuantile', 'RollingFracDiff', 'RollingMinMax', 'RollingMoments', 'RollingCov', 'RollingCorr', 'RollingBeta', 'RollingOLS']]
+
+# The Ew classes, except: todo baselines for 'EwSkew', 'EwKurt', and EwMoments
+# which has several outputs and its own tests, the two-input EwCov and EwCorr,
+# and the regression EwRLS
+ew_classes = [cls for cls in screamer_classes if cls.startswith('Ew') and not cls in['EwSkew', 'EwKurt', 'EwMoments', 'EwCov', 'EwCorr', 'EwRLS']]
 
 # Classes that have no arguments
 no_arg_classes = [
@@ -38,6 +47,17 @@ no_arg_classes = [
 test_definitions = [
     ( tuple(rolling_classes)     , {"window_size": [20]} ),
     ( ('RollingQuantile',)       , {"window_size": [20], "quantile": [0, 0.01, 0.4, 1]} ),
+    ( ('RollingQuantile',)       , {"window_size": [500], "quantile": [0.25, 0.9], "array_length": [3000]} ),
+    ( ('RollingMedian',)         , {"window_size": [500], "array_length": [3000]} ),
+    ( ('RollingApproxQuantile',) , {"window_size": [20], "quantile": [0.1, 0.5, 0.9], "rank_error": [0.05]} ),
+    ( ('P2Quantile',)            , {"quantile": [0.1, 0.5, 0.9]} ),
+    ( ('RollingRank',)           , {"window_size": [20], "normalize": [True, False]} ),
+    ( ('RollingRank',)           , {"window_size": [500], "array_length": [3000]} ),
+    ( ('RollingMAD',)            , {"window_size": [21, 500], "array_length": [3000]} ),
+    ( ('RollingHampel',)         , {"window_size": [20], "n_sigmas": [0.5, 3.0], "output": ["filtered", "flag"]} ),
+    ( ('RollingMin', 'RollingMax', 'RollingRange', 'RollingArgMin', 'RollingArgMax'), {"window_size": [1, 7, 500], "array_length": [3000]} ),
+    ( ('RollingMaxAbs', 'RollingProd', 'RollingAny', 'RollingAll'), {"window_size": [1, 7, 500], "array_length": [3000]} ),
+    ( ('RollingVar', 'RollingStd', 'RollingZscore', 'RollingSkew', 'RollingKurt'), {"window_size": [20, 500], "array_length": [3000]} ),
     ( ('RollingPoly1',)          , {"window_size": [20], "derivative_order": [0, 1] }),
     ( ('RollingPoly2',)          , {"window_size": [20], "derivative_order": [0, 1, 2] }),
     ( ('RollingFracDiff',)       , {"window_size": [20], "frac_order": [0.25, 0.5, 0.75, 1.0] }),
@@ -47,7 +67,11 @@ test_definitions = [
     ( tuple(ew_classes)          , {"com": [10]}),
     ( tuple(no_arg_classes)      , {"array_type": ["positive"]}),
     ( ('Butter',)                , {"order": [2,3,4,5,6,7,8,9,10], "cutoff_freq": [0.2]}),
-    ( ('Diff','Lag')             , {"window_size": [10]})
+    ( ('Diff','Lag')             , {"window_size": [10]}),
+    ( ('Pipeline',)              , {"stages": [
+                                        [screamer_module.Diff(1), screamer_module.EwMean(span=5), screamer_module.Clip(-1, 1)],
+                                        [screamer_module.RollingMean(5), screamer_module.Abs()],
+                                    ]})
 ]
 
 
@@ -0,0 +1,97 @@
+import numpy as np
+from devtools import sii
+import pytest
+
+screamer_module = sii.load_screamer_module()
+
+
+distributions = {
+    'normal': lambda n: np.random.normal(size=n),
+    'uniform': lambda n: np.random.uniform(size=n),
+    'heavy_tailed': lambda n: np.random.standard_t(df=2, size=n),
+    'random_walk': lambda n: np.cumsum(np.random.normal(size=n)),
+    'ties': lambda n: np.random.randint(0, 5, size=n).astype(np.float64),
+}
+
+
+def rank_interval(window, value):
+    """The ranks that value covers in the sorted window, a value that is not
+    in the window falls between rank hi and lo = hi + 1."""
+    return np.sum(window < value), np.sum(window <= value) - 1
+
+
+@pytest.mark.parametrize("distribution", list(distributions))
+@pytest.mark.parametrize("window_size, rank_error", [(50, 0.05), (1000, 0.05), (20000, 0.05)])
+@pytest.mark.parametrize("quantile", [0.01, 0.5, 0.95])
+def test_rolling_approx_quantile_rank_error(distribution, window_size, rank_error, quantile):
+    """The rank of the result is within rank_error * window_size of the exact rank."""
+
+    x = distributions[distribution](3 * window_size)
+    y = screamer_module.RollingApproxQuantile(window_size, quantile, rank_error)(x)
+
+    assert np.all(np.isnan(y[:window_size - 1]))
+
+    max_error = 0
+    for i in range(window_size - 1, len(x), max(1, window_size // 100)):
+        window = x[i - window_size + 1:i + 1]
+        target = quantile * (window_size - 1)
+        lo, hi = rank_interval(window, y[i])
+        max_error = max(max_error, lo - target, target - hi)
+
+    assert max_error <= rank_error * window_size
+
+
+def test_rolling_approx_quantile_nan():
+    """Windows that contain a NaN give NaN."""
+
+    x = np.random.normal(size=2000)
+    x[700] = np.nan
+    y = screamer_module.RollingApproxQuantile(100, 0.5, 0.05)(x)
+
+    assert np.all(np.isnan(y[700:800]))
+    assert not np.any(np.isnan(y[99:700]))
+    assert not np.any(np.isnan(y[800:]))
+
+
+def test_rolling_approx_quantile_small_window_is_exact():
+    """Windows too small to summarize are kept exactly."""
+
+    x = np.random.normal(size=500)
+    y = screamer_module.RollingApproxQuantile(20, 0.3, 0.01)(x)
+    exact = np.array([np.sort(x[i - 19:i + 1])[int(0.3 * 19)] for i in range(19, len(x))])
+
+    np.testing.assert_array_equal(y[19:], exact)
+
+
+@pytest.mark.parametrize("distribution", ['normal', 'uniform', 'heavy_tailed'])
+@pytest.mark.parametrize("quantile", [0.1, 0.5, 0.9])
+def test_p2_quantile_error(distribution, quantile):
+    """The P-square estimate is close to the quantile of all values seen so far."""
+
+    x = distributions[distribution](20000)
+    y = screamer_module.P2Quantile(quantile)(x)
+
+    for n in [5000, 20000]:
+        rank = np.sum(x[:n] < y[n - 1]) / n
+        assert abs(rank - quantile) < 0.03
+
+
+def test_p2_quantile_first_values():
+    """The first five values give the exact quantile."""
+
+    x = np.random.normal(size=5)
+    y = screamer_module.P2Quantile(0.25)(x)
+
+    for n in range(1, 6):
+        assert y[n - 1] == pytest.approx(np.quantile(x[:n], 0.25))
+
+
+def test_quantile_arguments():
+    with pytest.raises(ValueError):
+        screamer_module.RollingApproxQuantile(100, 1.5)
+    with pytest.raises(ValueError):
+        screamer_module.RollingApproxQuantile(100, 0.5, 0.0)
+    with pytest.raises(ValueError):
+        screamer_module.RollingApproxQuantile(0, 0.5)
+    with pytest.raises(ValueError):
+        screamer_module.P2Quantile(-0.1)
@@ -0,0 +1,89 @@
+import numpy as np
+from devtools import sii
+import pytest
+
+screamer_module = sii.load_screamer_module()
+
+
+# Bank class, the single series class it bundles, and their common parameters
+bank_cases = [
+    ('EwMeanBank', 'EwMean', {'span': 5}),
+    ('EwMeanBank', 'EwMean', {'halflife': 10}),
+    ('EwVarBank', 'EwVar', {'alpha': 0.2}),
+    ('EwStdBank', 'EwStd', {'com': 10}),
+    ('RollingSumBank', 'RollingSum', {'window_size': 20}),
+    ('RollingSumBank', 'RollingSum', {'window_size': 20, 'start_policy': 'expanding'}),
+    ('RollingMeanBank', 'RollingMean', {'window_size': 20}),
+    ('RollingMeanBank', 'RollingMean', {'window_size': 20, 'start_policy': 'expanding'}),
+    ('RollingMeanBank', 'RollingMean', {'window_size': 20, 'start_policy': 'zero'}),
+    ('RollingZscoreBank', 'RollingZscore', {'window_size': 20}),
+]
+
+
+@pytest.mark.parametrize("bank_name, class_name, params", bank_cases)
+def test_bank_vs_single(bank_name, class_name, params):
+    """A bank of n series gives the same results as n separate objects."""
+
+    n = 11
+    input_matrix = np.random.normal(size=(100, n))
+
+    bank = getattr(screamer_module, bank_name)(n, **params)
+    single = getattr(screamer_module, class_name)(**params)
+
+    # Tick by tick, a length n vector per call
+    bank_output_1 = np.stack([bank(row) for row in input_matrix])
+
+    # All ticks at once, continuing from the state after reset
+    bank.reset()
+    bank_output_2 = bank(input_matrix)
+
+    # Each series with its own object
+    single_output = single(input_matrix)
+
+    assert len(bank) == n
+    np.testing.assert_array_equal(bank_output_1, bank_output_2)
+    np.testing.assert_allclose(
+        bank_output_1, single_output, rtol=1e-10, atol=1e-12,
+        err_msg=f"Results do not match for {bank_name} with params {params}"
+    )
+
+
+@pytest.mark.parametrize("bank_name, class_name, params", bank_cases)
+def test_bank_streaming(bank_name, class_name, params):
+    """Banks continue from their state, chunks give the same result as all at once."""
+
+    n = 4
+    input_matrix = np.random.normal(size=(60, n))
+    bank = getattr(screamer_module, bank_name)(n, **params)
+
+    output_1 = bank(input_matrix)
+    bank.reset()
+    output_2 = np.concatenate([bank(input_matrix[:25]), bank(input_matrix[25:])])
+
+    np.testing.assert_array_equal(output_1, output_2)
+
+
+def test_bank_shape_errors():
+    bank = screamer_module.RollingMeanBank(3, 5)
+
+    with pytest.raises(ValueError):
+        bank(np.zeros(4))
+
+    with pytest.raises(ValueError):
+        bank(np.zeros((10, 4)))
+
+    with pytest.raises(ValueError):
+        screamer_module.EwStdBank(0, span=5)
+
+    with pytest.raises(ValueError):
+        screamer_module.RollingZscoreBank(3, 1)
+
+
+def test_rolling_zscore_bank_large_window():
+    """The normalization of windows past 46341 values doesn't overflow."""
+
+    window_size = 50000
+    x = np.random.normal(size=(window_size + 10, 2))
+    bank = screamer_module.RollingZscoreBank(2, window_size)
+    single = screamer_module.RollingZscore(window_size)
+    np.testing.assert_allclose(bank(x), single(x), rtol=1e-8, atol=1e-10)
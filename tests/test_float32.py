@@ -0,0 +1,46 @@
+import numpy as np
+from .param_cases import yield_test_cases, generate_array
+from devtools import sii
+import pytest
+
+screamer_module = sii.load_screamer_module()
+
+
+# Create a pytest parameterization using the collected test cases
+@pytest.mark.parametrize(
+    "class_name, params, array_type, array_length",
+    yield_test_cases()
+)
+def test_screamer_float32(class_name, params, array_type, array_length):
+    """float32 input gives float32 output that matches the float64 result."""
+
+    # Get screamer class
+    screamer_class = getattr(screamer_module, class_name, None)
+
+    # Instantiate the screamer object
+    screamer_instance = screamer_class(**params)
+
+    # Generate a 1d array, a N x 7 matrix, and a strided view
+    input_array = generate_array(array_type, array_length).astype(np.float32)
+    input_matrix = np.column_stack([
+        generate_array(array_type, array_length) for _ in range(7)
+    ]).astype(np.float32)
+
+    for x in [input_array, input_matrix, input_matrix[::2, ::3]]:
+        output_32 = screamer_instance(x)
+        output_64 = screamer_instance(x.astype(np.float64))
+
+        assert output_32.dtype == np.float32
+        assert output_32.shape == x.shape
+        np.testing.assert_allclose(
+            output_32, output_64, rtol=1e-5, atol=1e-6,
+            err_msg=f"Results do not match for {class_name}  with params {params} and array type '{array_type}' of length {array_length}"
+        )
+
+        # out= must match the dtype of the result
+        out = np.empty_like(x)
+        screamer_instance(x, out=out)
+        np.testing.assert_array_equal(out, output_32)
+
+        with pytest.raises(TypeError):
+            screamer_instance(x, out=np.empty(x.shape, dtype=np.float64))
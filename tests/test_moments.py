@@ -0,0 +1,100 @@
+import numpy as np
+from devtools import sii
+import pytest
+
+screamer_module = sii.load_screamer_module()
+
+single_rolling = {
+    'mean': 'RollingMean',
+    'var': 'RollingVar',
+    'std': 'RollingStd',
+    'skew': 'RollingSkew',
+    'kurt': 'RollingKurt',
+}
+
+single_ew = {
+    'mean': 'EwMean',
+    'var': 'EwVar',
+    'std': 'EwStd',
+    'skew': 'EwSkew',
+    'kurt': 'EwKurt',
+}
+
+output_lists = [
+    ['mean', 'std', 'skew', 'kurt'],
+    ['kurt', 'mean'],
+    ['var'],
+    ['skew', 'var', 'skew'],
+]
+
+
+def stream(obj, x):
+    return np.array([obj.update(v) for v in x])
+
+
+@pytest.mark.parametrize("outputs", output_lists)
+@pytest.mark.parametrize("start_policy", ['strict', 'expanding', 'zero'])
+@pytest.mark.parametrize("window_size", [3, 20])
+def test_rolling_moments_vs_single(outputs, start_policy, window_size):
+    """Each output equals the single output class with the same parameters."""
+
+    x = np.random.normal(size=300)
+    x[150] = np.nan
+    obj = screamer_module.RollingMoments(window_size, outputs=outputs, start_policy=start_policy)
+    y = obj(x)
+    assert y.shape == (300, len(outputs))
+    np.testing.assert_array_equal(y, stream(obj, x))
+
+    for j, output in enumerate(outputs):
+        single = getattr(screamer_module, single_rolling[output])(window_size, start_policy=start_policy)
+        np.testing.assert_allclose(y[:, j], stream(single, x), rtol=1e-6, atol=1e-9)
+
+
+@pytest.mark.parametrize("outputs", output_lists)
+@pytest.mark.parametrize("params", [{'span': 5}, {'halflife': 30}, {'alpha': 0.5}])
+def test_ew_moments_vs_single(outputs, params):
+    """Each output equals the single output class with the same decay."""
+
+    x = np.random.normal(size=300)
+    x[150] = np.nan
+    obj = screamer_module.EwMoments(outputs, **params)
+    y = obj(x)
+    assert y.shape == (300, len(outputs))
+    np.testing.assert_array_equal(y, stream(obj, x))
+
+    for j, output in enumerate(outputs):
+        single = getattr(screamer_module, single_ew[output])(**params)
+        np.testing.assert_allclose(y[:, j], stream(single, x), rtol=1e-6, atol=1e-9)
+
+
+@pytest.mark.parametrize("obj", [
+    screamer_module.RollingMoments(20),
+    screamer_module.EwMoments(span=20),
+])
+def test_moments_default_outputs(obj):
+    """The default outputs are mean, std, skew and kurt, scalars give a tuple."""
+
+    x = np.random.normal(size=(50, 3))
+    assert obj(x).shape == (50, 3, 4)
+
+    obj.reset()
+    values = [obj(v) for v in x[:, 0]]
+    assert all(isinstance(v, tuple) and len(v) == 4 for v in values)
+    np.testing.assert_array_equal(np.array(values), obj(x[:, 0]))
+
+
+def test_moments_errors():
+    with pytest.raises(ValueError):
+        screamer_module.RollingMoments(20, outputs=[])
+    with pytest.raises(ValueError):
+        screamer_module.RollingMoments(20, outputs=['mean', 'median'])
+    with pytest.raises(ValueError):
+        screamer_module.RollingMoments(2, outputs=['skew'])
+    with pytest.raises(ValueError):
+        screamer_module.RollingMoments(20, start_policy='lazy')
+    with pytest.raises(ValueError):
+        screamer_module.EwMoments(['mean'])
+    with pytest.raises(ValueError):
+        screamer_module.EwMoments(['mode'], span=5)
+    with pytest.raises(ValueError):
+        screamer_module.Pipeline([screamer_module.RollingMoments(20)])
@@ -0,0 +1,109 @@
+import numpy as np
+from devtools import sii
+import pytest
+
+screamer_module = sii.load_screamer_module()
+
+
+# Multi-output class, its parameters, and for each output the single output
+# class and parameters that compute the same values
+multi_output_cases = [
+    (
+        'RollingQuantile', {'window_size': 20, 'quantiles': [0.05, 0.25, 0.5, 0.75, 0.95]},
+        [('RollingQuantile', {'window_size': 20, 'quantile': q}) for q in [0.05, 0.25, 0.5, 0.75, 0.95]]
+    ),
+    (
+        'RollingQuantile', {'window_size': 7, 'quantiles': [0.5]},
+        [('RollingQuantile', {'window_size': 7, 'quantile': 0.5})]
+    ),
+    (
+        'RollingMinMax', {'window_size': 15},
+        [('RollingMin', {'window_size': 15}), ('RollingMax', {'window_size': 15})]
+    ),
+    (
+        'RollingArgMax', {'window_size': 15, 'with_value': True},
+        [('RollingMax', {'window_size': 15}), ('RollingArgMax', {'window_size': 15})]
+    ),
+    (
+        'RollingArgMin', {'window_size': 15, 'with_value': True},
+        [('RollingMin', {'window_size': 15}), ('RollingArgMin', {'window_size': 15})]
+    ),
+]
+
+
+def make_single(outputs):
+    return [getattr(screamer_module, name)(**params) for name, params in outputs]
+
+
+@pytest.mark.parametrize("class_name, params, outputs", multi_output_cases)
+@pytest.mark.parametrize("dtype", [np.float64, np.float32])
+def test_multi_output_array(class_name, params, outputs, dtype):
+    """Arrays get an extra last dimension with one value per output."""
+
+    k = len(outputs)
+    x = np.random.normal(size=(200, 3)).astype(dtype)
+    x[::13, 1] = np.nan
+
+    obj = getattr(screamer_module, class_name)(**params)
+    y = obj(x)
+
+    assert y.shape == (200, 3, k)
+    assert y.dtype == dtype
+    for j, single in enumerate(make_single(outputs)):
+        np.testing.assert_array_equal(y[..., j], single(x))
+
+    # 1-dimensional and strided input
+    y1 = obj(x[::2, 1])
+    assert y1.shape == (100, k)
+    np.testing.assert_array_equal(y1, obj(np.ascontiguousarray(x[::2, 1])))
+
+
+@pytest.mark.parametrize("class_name, params, outputs", multi_output_cases)
+def test_multi_output_scalar(class_name, params, outputs):
+    """Scalars give a tuple with one value per output, equal to the array result."""
+
+    x = np.random.normal(size=100)
+    obj = getattr(screamer_module, class_name)(**params)
+    expected = obj(x)
+
+    obj.reset()
+    stream = [obj(v) for v in x]
+    assert all(isinstance(s, tuple) and len(s) == len(outputs) for s in stream)
+    np.testing.assert_array_equal(np.array(stream), expected)
+
+    obj.reset()
+    np.testing.assert_array_equal(np.array([obj.update(v) for v in x]), expected)
+
+    obj.reset()
+    np.testing.assert_array_equal(np.array(list(obj(iter(x)))), expected)
+
+
+@pytest.mark.parametrize("class_name, params, outputs", multi_output_cases)
+def test_multi_output_update_and_out(class_name, params, outputs):
+    """update() continues from the state, out= receives the result."""
+
+    k = len(outputs)
+    x = np.random.normal(size=100)
+    obj = getattr(screamer_module, class_name)(**params)
+    expected = obj(x)
+
+    obj.reset()
+    chunks = np.concatenate([obj.update(x[:30]), obj.update(x[30:])])
+    np.testing.assert_array_equal(chunks, expected)
+
+    out = np.empty((100, k))
+    result = obj(x, out=out)
+    assert np.shares_memory(result, out)
+    np.testing.assert_array_equal(out, expected)
+
+    with pytest.raises(ValueError):
+        obj(x, out=np.empty(100))
+
+
+def test_rolling_quantile_errors():
+    with pytest.raises(ValueError):
+        screamer_module.RollingQuantile(20, quantiles=[])
+    with pytest.raises(ValueError):
+        screamer_module.RollingQuantile(20, quantiles=[0.5, 1.5])
+    with pytest.raises(ValueError):
+        screamer_module.Pipeline([screamer_module.RollingQuantile(20, quantiles=[0.1, 0.9])])
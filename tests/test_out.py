@@ -0,0 +1,91 @@
+import numpy as np
+from .param_cases import yield_test_cases, generate_array
+from devtools import sii
+import pytest
+
+screamer_module = sii.load_screamer_module()
+
+
+# Create a pytest parameterization using the collected test cases
+@pytest.mark.parametrize(
+    "class_name, params, array_type, array_length",
+    yield_test_cases()
+)
+def test_screamer_out(class_name, params, array_type, array_length):
+    """Compare writing into a caller supplied out= array with a newly allocated result."""
+
+    # Get screamer class
+    screamer_class = getattr(screamer_module, class_name, None)
+
+    # Instantiate the screamer object
+    screamer_instance = screamer_class(**params)
+
+    # Generate a 1d array and a N x 7 matrix
+    input_array = generate_array(array_type, array_length)
+    input_matrix = np.column_stack([
+        generate_array(array_type, array_length) for _ in range(7)
+    ])
+
+    for x in [input_array, input_matrix]:
+        expected = screamer_instance(x)
+
+        # Write into a separate buffer, the buffer itself is returned
+        out = np.full_like(x, 123.0)
+        result = screamer_instance(x, out=out)
+        assert result is out
+        np.testing.assert_array_equal(out, expected)
+
+        # Write into a strided view
+        out_view = np.full(x.shape + (2,), 123.0)[..., 0]
+        screamer_instance(x, out=out_view)
+        np.testing.assert_array_equal(out_view, expected)
+
+        # In-place, this gives the same result for all operators
+        x_copy = x.copy()
+        screamer_instance(x_copy, out=x_copy)
+        np.testing.assert_array_equal(x_copy, expected)
+
+
+# Create a pytest parameterization using the collected test cases
+@pytest.mark.parametrize(
+    "class_name, params, array_type, array_length",
+    yield_test_cases()
+)
+def test_screamer_out_overlap(class_name, params, array_type, array_length):
+    """Output that partially overlaps the input must not corrupt the result."""
+
+    screamer_class = getattr(screamer_module, class_name, None)
+    screamer_instance = screamer_class(**params)
+
+    buffer = generate_array(array_type, array_length + 1)
+    expected = screamer_instance(buffer[1:].copy())
+
+    screamer_instance(buffer[1:], out=buffer[:-1])
+    np.testing.assert_array_equal(buffer[:-1], expected)
+
+
+def test_screamer_out_errors():
+    """Invalid out= arrays are rejected."""
+
+    screamer_instance = screamer_module.RollingMean(5)
+    x = np.random.normal(size=(20, 3))
+
+    with pytest.raises(ValueError):
+        screamer_instance(x, out=np.empty((20, 4)))
+
+    with pytest.raises(ValueError):
+        screamer_instance(x, out=np.empty(60))
+
+    with pytest.raises(TypeError):
+        screamer_instance(x, out=np.empty((20, 3), dtype=np.float32))
+
+    with pytest.raises(TypeError):
+        screamer_instance(x, out=[0.0] * 60)
+
+    read_only = np.empty((20, 3))
+    read_only.flags.writeable = False
+    with pytest.raises(ValueError):
+        screamer_instance(x, out=read_only)
+
+    with pytest.raises(ValueError):
+        screamer_instance(1.0, out=np.empty(1))
@@ -0,0 +1,114 @@
+import numpy as np
+import pandas as pd
+from devtools import sii
+import pytest
+
+screamer_module = sii.load_screamer_module()
+
+
+def pandas_rolling(name, window_size, x, y):
+    xs, ys = pd.Series(x), pd.Series(y)
+    if name == 'RollingCov':
+        return xs.rolling(window_size).cov(ys).to_numpy()
+    if name == 'RollingCorr':
+        return xs.rolling(window_size).corr(ys).to_numpy()
+    return (xs.rolling(window_size).cov(ys) / xs.rolling(window_size).var()).to_numpy()
+
+
+def pandas_ew(name, params, x, y):
+    xs, ys = pd.Series(x), pd.Series(y)
+    if name == 'EwCov':
+        return xs.ewm(**params).cov(ys).to_numpy()
+    return xs.ewm(**params).corr(ys).to_numpy()
+
+
+def stream(obj, x, y):
+    return np.array([obj.update(a, b) for a, b in zip(x, y)])
+
+
+def random_pair(size):
+    x = np.random.normal(size=size)
+    y = 0.5 * x + np.random.normal(size=size)
+    return x, y
+
+
+@pytest.mark.parametrize("name", ['RollingCov', 'RollingCorr', 'RollingBeta'])
+@pytest.mark.parametrize("window_size", [3, 20, 500])
+def test_rolling_pairwise_vs_pandas(name, window_size):
+    x, y = random_pair(3000)
+    obj = getattr(screamer_module, name)(window_size)
+    result = obj(x, y)
+    np.testing.assert_allclose(result, pandas_rolling(name, window_size, x, y), rtol=1e-6, atol=1e-9)
+    np.testing.assert_allclose(stream(obj, x, y), result, rtol=1e-6, atol=1e-9)
+
+
+@pytest.mark.parametrize("name", ['EwCov', 'EwCorr'])
+@pytest.mark.parametrize("params", [{'span': 5}, {'alpha': 0.2}, {'halflife': 10}, {'com': 10}])
+def test_ew_pairwise_vs_pandas(name, params):
+    x, y = random_pair(3000)
+    obj = getattr(screamer_module, name)(**params)
+    result = obj(x, y)
+    np.testing.assert_allclose(result, pandas_ew(name, params, x, y), rtol=1e-6, atol=1e-9)
+    np.testing.assert_allclose(stream(obj, x, y), result, rtol=1e-6, atol=1e-9)
+
+
+pairwise_objects = [
+    lambda: screamer_module.RollingCov(20),
+    lambda: screamer_module.RollingCorr(20, start_policy='expanding'),
+    lambda: screamer_module.RollingBeta(20, start_policy='zero'),
+    lambda: screamer_module.EwCov(span=20),
+    lambda: screamer_module.EwCorr(halflife=10),
+]
+
+
+@pytest.mark.parametrize("make", pairwise_objects)
+def test_pairwise_array_layouts(make):
+    """Columns, strided and float32 arrays, out= and update() give the streamed values."""
+
+    x, y = random_pair((300, 3))
+    x[150, 1] = np.nan
+    expected = np.stack([stream(make(), x[:, j], y[:, j]) for j in range(3)], axis=1)
+
+    np.testing.assert_allclose(make()(x, y), expected, rtol=1e-6, atol=1e-9)
+    np.testing.assert_allclose(make()(x, y, n_threads=3), expected, rtol=1e-6, atol=1e-9)
+    np.testing.assert_allclose(make()(x[::2, 0], y[::2, 0]), stream(make(), x[::2, 0], y[::2, 0]), rtol=1e-6, atol=1e-9)
+
+    out = np.empty_like(x)
+    result = make()(x, y, out=out)
+    assert result is out
+    np.testing.assert_allclose(out, expected, rtol=1e-6, atol=1e-9)
+
+    result32 = make()(x.astype(np.float32), y.astype(np.float32))
+    assert result32.dtype == np.float32
+    np.testing.assert_allclose(result32, expected, rtol=1e-3, atol=1e-3)
+
+    obj = make()
+    chunks = np.concatenate([obj.update(x[:100, 0], y[:100, 0]), obj.update(x[100:, 0], y[100:, 0])])
+    np.testing.assert_allclose(chunks, expected[:, 0], rtol=1e-6, atol=1e-9)
+
+    obj = make()
+    np.testing.assert_allclose(list(obj(iter(x[:, 0]), iter(y[:, 0]))), expected[:, 0], rtol=1e-6, atol=1e-9)
+
+
+def test_pairwise_same_series():
+    """The covariance of a series with itself is its variance."""
+
+    x = np.random.normal(size=1000)
+    np.testing.assert_allclose(screamer_module.RollingCov(20)(x, x), screamer_module.RollingVar(20)(x), rtol=1e-9)
+    np.testing.assert_allclose(screamer_module.EwCov(span=20)(x, x), screamer_module.EwVar(span=20)(x), rtol=1e-9)
+    np.testing.assert_allclose(screamer_module.RollingBeta(20)(x, 3 * x)[19:], 3.0, rtol=1e-9)
+    np.testing.assert_allclose(screamer_module.RollingCorr(20)(x, -x)[19:], -1.0, rtol=1e-9)
+
+
+def test_pairwise_errors():
+    x = np.random.normal(size=10)
+    with pytest.raises(ValueError):
+        screamer_module.RollingCov(20)(x, x[:5])
+    with pytest.raises(ValueError):
+        screamer_module.RollingCorr(20)(1.0, x)
+    with pytest.raises(ValueError):
+        screamer_module.RollingBeta(1)
+    with pytest.raises(ValueError):
+        screamer_module.RollingCov(20, start_policy='lazy')
+    with pytest.raises(ValueError):
+        screamer_module.EwCov()
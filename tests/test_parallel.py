@@ -0,0 +1,40 @@
+import numpy as np
+from .param_cases import yield_test_cases, generate_array
+from devtools import sii
+import pytest
+
+screamer_module = sii.load_screamer_module()
+
+
+# Create a pytest parameterization using the collected test cases
+@pytest.mark.parametrize(
+    "class_name, params, array_type, array_length",
+    yield_test_cases()
+)
+def test_screamer_parallel(class_name, params, array_type, array_length):
+    """Compare column-parallel matrix processing with serial matrix processing."""
+
+    # Get screamer class
+    screamer_class = getattr(screamer_module, class_name, None)
+
+    # Instantiate the screamer objects
+    screamer_instance_1 = screamer_class(**params)
+    screamer_instance_2 = screamer_class(**params)
+
+    # Generate a N x 7 input matix
+    input_array = np.column_stack([
+        generate_array(array_type, array_length) for _ in range(7)
+    ])
+
+    # Run the serial version
+    screamer_output_1 = screamer_instance_1(input_array)
+
+    # Run the parallel version, more threads than columns is allowed
+    screamer_output_2 = screamer_instance_2(input_array, n_threads=3)
+    screamer_output_3 = screamer_instance_2(input_array, n_threads=16)
+
+    np.testing.assert_array_equal(
+        screamer_output_1, screamer_output_2,
+        err_msg=f"Results do not match for {class_name}  with params {params} and array type '{array_type}' of length {array_length}"
+    )
+    np.testing.assert_array_equal(screamer_output_1, screamer_output_3)
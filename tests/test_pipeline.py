@@ -0,0 +1,65 @@
+import numpy as np
+from devtools import sii
+import pytest
+
+screamer_module = sii.load_screamer_module()
+
+
+def make_stages():
+    return [
+        screamer_module.LogReturn(1),
+        screamer_module.EwZscore(halflife=50),
+        screamer_module.Clip(-3, 3),
+        screamer_module.RollingMean(5),
+    ]
+
+
+def test_pipeline_vs_chain():
+    """A pipeline gives the same result as applying the stages one by one."""
+
+    x = np.exp(np.cumsum(np.random.normal(scale=0.01, size=1000)))
+
+    chain = x
+    for stage in make_stages():
+        chain = stage(chain)
+
+    pipeline = screamer_module.Pipeline(make_stages())
+    assert len(pipeline) == 4
+
+    np.testing.assert_allclose(pipeline(x), chain, rtol=1e-12, atol=1e-12)
+
+    # Streaming value by value
+    stream = np.array([pipeline(v) for v in x])
+    np.testing.assert_allclose(stream, chain, rtol=1e-12, atol=1e-12)
+
+
+def test_pipeline_copies_stages():
+    """The pipeline has its own copy of the stages."""
+
+    ewm = screamer_module.EwMean(span=5)
+    pipeline = screamer_module.Pipeline([ewm])
+
+    pipeline(np.arange(10.0))
+    pipeline.update(np.arange(10.0))
+
+    # ewm still has its initial state
+    assert ewm(1.0) == 1.0
+
+
+def test_pipeline_nested():
+    """Pipelines can be stages of other pipelines."""
+
+    x = np.random.normal(size=100)
+    inner = screamer_module.Pipeline([screamer_module.Diff(1), screamer_module.Abs()])
+    outer = screamer_module.Pipeline([inner, screamer_module.RollingMax(5)])
+
+    expected = screamer_module.RollingMax(5)(screamer_module.Abs()(screamer_module.Diff(1)(x)))
+    np.testing.assert_allclose(outer(x), expected)
+
+
+def test_pipeline_errors():
+    with pytest.raises(ValueError):
+        screamer_module.Pipeline([])
+
+    with pytest.raises(TypeError):
+        screamer_module.Pipeline([screamer_module.Diff(1), "Abs"])
@@ -0,0 +1,149 @@
+import numpy as np
+from devtools import sii
+import pytest
+
+screamer_module = sii.load_screamer_module()
+
+
+def random_regression(n, k):
+    x = np.random.normal(size=(n, k))
+    y = 0.5 + x @ np.arange(1, k + 1) + np.random.normal(size=n)
+    return x, y
+
+
+def design(x, fit_intercept):
+    return np.column_stack([np.ones(len(x)), x]) if fit_intercept else x
+
+
+def rolling_ols_numpy(x, y, window_size, output, fit_intercept, start_policy):
+    """Fit each window with numpy least squares."""
+    X = design(x, fit_intercept)
+    n, p = X.shape
+    result = np.full((n, p) if output == 'coef' else n, np.nan)
+    for t in range(n):
+        lo = max(0, t + 1 - window_size)
+        rows = t + 1 - lo
+        if rows < p or (start_policy == 'strict' and rows < window_size):
+            continue
+        A, b = X[lo:t + 1], y[lo:t + 1]
+        if not np.all(np.isfinite(A)) or not np.all(np.isfinite(b)):
+            continue
+        beta = np.linalg.lstsq(A, b, rcond=None)[0]
+        if output == 'coef':
+            result[t] = beta
+        elif output == 'residual':
+            result[t] = b[-1] - A[-1] @ beta
+        else:
+            ssr = np.sum((b - A @ beta) ** 2)
+            sst = np.sum((b - b.mean()) ** 2) if fit_intercept else np.sum(b ** 2)
+            result[t] = 1 - ssr / sst
+    return result
+
+
+@pytest.mark.parametrize("output", ['coef', 'residual', 'r2'])
+@pytest.mark.parametrize("fit_intercept", [True, False])
+@pytest.mark.parametrize("start_policy", ['strict', 'expanding'])
+@pytest.mark.parametrize("window_size,k", [(5, 1), (30, 3), (100, 10)])
+def test_rolling_ols_vs_numpy(output, fit_intercept, start_policy, window_size, k):
+    x, y = random_regression(500, k)
+    x[200, 0] = np.nan
+    y[300] = np.nan
+    obj = screamer_module.RollingOLS(window_size, k, output=output, fit_intercept=fit_intercept, start_policy=start_policy)
+    result = obj(x, y)
+    expected = rolling_ols_numpy(x, y, window_size, output, fit_intercept, start_policy)
+    np.testing.assert_allclose(result, expected, rtol=1e-6, atol=1e-8)
+
+
+def ew_rls_numpy(x, y, alpha, output, fit_intercept):
+    """Fit all valid rows so far with numpy weighted least squares."""
+    X = design(x, fit_intercept)
+    n, p = X.shape
+    result = np.full((n, p) if output == 'coef' else n, np.nan)
+    valid = np.all(np.isfinite(X), axis=1) & np.isfinite(y)
+    for t in range(n):
+        rows = np.flatnonzero(valid[:t + 1])
+        if not valid[t] or len(rows) < p:
+            continue
+        w = (1 - alpha) ** np.arange(len(rows) - 1, -1, -1)
+        A, b = X[rows], y[rows]
+        sw = np.sqrt(w)
+        beta = np.linalg.lstsq(A * sw[:, None], b * sw, rcond=None)[0]
+        if output == 'coef':
+            result[t] = beta
+        elif output == 'residual':
+            result[t] = b[-1] - A[-1] @ beta
+        else:
+            ssr = np.sum(w * (b - A @ beta) ** 2)
+            mean = np.sum(w * b) / np.sum(w)
+            sst = np.sum(w * (b - mean) ** 2) if fit_intercept else np.sum(w * b ** 2)
+            result[t] = 1 - ssr / sst
+    return result
+
+
+@pytest.mark.parametrize("output", ['coef', 'residual', 'r2'])
+@pytest.mark.parametrize("fit_intercept", [True, False])
+@pytest.mark.parametrize("params,alpha", [({'alpha': 0.2}, 0.2), ({'span': 39}, 0.05), ({'com': 9}, 0.1)])
+@pytest.mark.parametrize("k", [1, 3, 10])
+def test_ew_rls_vs_numpy(output, fit_intercept, params, alpha, k):
+    x, y = random_regression(300, k)
+    x[100, 0] = np.nan
+    y[120] = np.nan
+    obj = screamer_module.EwRLS(k, output=output, fit_intercept=fit_intercept, **params)
+    result = obj(x, y)
+    expected = ew_rls_numpy(x, y, alpha, output, fit_intercept)
+    np.testing.assert_allclose(result, expected, rtol=1e-6, atol=1e-8)
+
+
+@pytest.mark.parametrize("make", [
+    lambda output: screamer_module.RollingOLS(50, 4, output=output),
+    lambda output: screamer_module.EwRLS(4, halflife=20, output=output),
+])
+@pytest.mark.parametrize("output", ['coef', 'residual', 'r2'])
+def test_regression_streaming(make, output):
+    """Rows one at a time and chunks of rows give the array results."""
+
+    x, y = random_regression(300, 4)
+    obj = make(output)
+    expected = obj(x, y)
+    assert expected.shape == ((300, 5) if output == 'coef' else (300,))
+
+    rows = [obj.update(x[i], y[i]) for i in range(300)]
+    if output == 'coef':
+        assert all(isinstance(v, tuple) and len(v) == 5 for v in rows)
+    np.testing.assert_array_equal(np.array(rows, dtype=float), expected)
+
+    obj.reset()
+    chunks = np.concatenate([obj.update(x[:120], y[:120]), obj.update(x[120:], y[120:])])
+    np.testing.assert_array_equal(chunks, expected)
+
+
+def test_rolling_ols_recovers_from_nan():
+    x, y = random_regression(200, 2)
+    y[50] = np.nan
+    result = screamer_module.RollingOLS(20, 2)(x, y)
+    assert np.all(np.isnan(result[50:70]))
+    assert np.all(np.isfinite(result[70:]))
+
+
+def test_regression_errors():
+    x, y = random_regression(10, 3)
+    with pytest.raises(ValueError):
+        screamer_module.RollingOLS(20, 0)
+    with pytest.raises(ValueError):
+        screamer_module.RollingOLS(3, 3)
+    with pytest.raises(ValueError):
+        screamer_module.RollingOLS(20, 3, output='alpha')
+    with pytest.raises(ValueError):
+        screamer_module.RollingOLS(20, 3, start_policy='zero')
+    with pytest.raises(ValueError):
+        screamer_module.RollingOLS(20, 2)(x, y)
+    with pytest.raises(ValueError):
+        screamer_module.RollingOLS(20, 3)(x, y[:5])
+    with pytest.raises(ValueError):
+        screamer_module.RollingOLS(20, 3)(x[0, :2], 1.0)
+    with pytest.raises(ValueError):
+        screamer_module.EwRLS(3)
+    with pytest.raises(ValueError):
+        screamer_module.EwRLS(0, span=10)
+    with pytest.raises(ValueError):
+        screamer_module.EwRLS(3, span=10, output='alpha')
@@ -35,3 +35,114 @@ def test_screamer_vs_batch(class_name, params, array_type, array_length):
         screamer_output_1, screamer_output_2, rtol=1e-5, atol=1e-8,
         err_msg=f"Results do not match for {class_name}  with params {params} and array type '{array_type}' of length {array_length}"
     )
+
+
+# Arrays of RollingQuantile, RollingMedian and the rolling extremes that span
+# several windows are processed offline, these must give exactly the
+# streaming values
+@pytest.mark.parametrize("class_name, params", [
+    ('RollingQuantile', {'window_size': 10, 'quantile': 0.3}),
+    ('RollingQuantile', {'window_size': 300, 'quantile': 0.0}),
+    ('RollingQuantile', {'window_size': 300, 'quantile': 0.9}),
+    ('RollingMedian', {'window_size': 300}),
+    ('RollingMedian', {'window_size': 301}),
+    ('RollingMax', {'window_size': 7}),
+    ('RollingRange', {'window_size': 300}),
+    ('RollingArgMax', {'window_size': 7}),
+    ('RollingArgMin', {'window_size': 300}),
+])
+@pytest.mark.parametrize("array_type", ['default', 'nan', 'ties'])
+def test_offline_windows_vs_stream(class_name, params, array_type):
+    x = np.random.normal(size=5000)
+    if array_type == 'nan':
+        x[::97] = np.nan
+        x[2000:2400] = np.nan
+    if array_type == 'ties':
+        x = np.round(x * 2) + 0.0
+
+    stream = getattr(screamer_module, class_name)(**params)
+    expected = np.array([stream(v) for v in x])
+
+    batch = getattr(screamer_module, class_name)(**params)
+    np.testing.assert_array_equal(batch(x), expected)
+
+    # Strided arrays
+    np.testing.assert_array_equal(batch(np.repeat(x, 2)[::2]), expected)
+
+
+# The running sums of the rolling moments stay NaN after a NaN, and after
+# an inf that gives inf - inf, arrays are processed in runs of windows and
+# must give the same
+@pytest.mark.parametrize("class_name", ['RollingVar', 'RollingStd', 'RollingZscore', 'RollingSkew', 'RollingKurt'])
+@pytest.mark.parametrize("bad_value", [np.nan, np.inf, -np.inf])
+def test_rolling_moments_nan_vs_stream(class_name, bad_value):
+    x = np.random.normal(size=3000)
+    x[1700] = bad_value
+
+    stream = getattr(screamer_module, class_name)(20)
+    expected = np.array([stream(v) for v in x])
+    assert np.all(np.isnan(expected[1700:]))
+
+    batch = getattr(screamer_module, class_name)(20)
+    np.testing.assert_allclose(batch(x), expected, rtol=1e-5, atol=1e-8)
+
+
+@pytest.mark.parametrize("class_name", ['RollingCov', 'RollingCorr', 'RollingBeta'])
+@pytest.mark.parametrize("bad_value", [np.nan, np.inf, -np.inf])
+@pytest.mark.parametrize("bad_input", [0, 1])
+def test_rolling_pairwise_nan_vs_stream(class_name, bad_value, bad_input):
+    xy = np.random.normal(size=(2, 3000))
+    xy[bad_input, 1700] = bad_value
+    x, y = xy
+
+    stream = getattr(screamer_module, class_name)(20)
+    expected = np.array([stream.update(a, b) for a, b in zip(x, y)])
+    assert np.all(np.isnan(expected[1700:]))
+
+    batch = getattr(screamer_module, class_name)(20)
+    np.testing.assert_allclose(batch(x, y), expected, rtol=1e-5, atol=1e-8)
+
+
+# Windows with NaN give NaN for the rolling extremes, the NaN leaves with its
+# window. Streams and arrays are compared with a brute force window.
+def _brute_force_windows(x, window_size, f):
+    out = np.empty(len(x))
+    for i in range(len(x)):
+        w = x[max(0, i - window_size + 1):i + 1]
+        out[i] = np.nan if np.isnan(w).any() else f(w)
+    return out
+
+
+@pytest.mark.parametrize("class_name, f", [
+    ('RollingMax', np.max),
+    ('RollingMin', np.min),
+    ('RollingRange', lambda w: np.max(w) - np.min(w)),
+    ('RollingArgMax', lambda w: len(w) - 1 - np.flatnonzero(w == np.max(w))[-1]),
+    ('RollingArgMin', lambda w: len(w) - 1 - np.flatnonzero(w == np.min(w))[-1]),
+])
+@pytest.mark.parametrize("window_size", [3, 7])
+def test_rolling_extremes_nan_vs_brute_force(class_name, f, window_size):
+    x = np.round(np.random.normal(size=500) * 2)
+    x[::31] = np.nan
+    x[200:205] = np.nan
+    expected = _brute_force_windows(x, window_size, f)
+
+    stream = getattr(screamer_module, class_name)(window_size)
+    np.testing.assert_array_equal(np.array([stream(v) for v in x]), expected)
+
+    batch = getattr(screamer_module, class_name)(window_size)
+    np.testing.assert_array_equal(batch(x), expected)
+
+
+def test_rolling_max_nan_leaves_window():
+    x = np.array([5.0, 1.0, np.nan, 2.0, 1.0, 0.0])
+    stream = screamer_module.RollingMax(3)
+    np.testing.assert_array_equal([stream(v) for v in x], [5, 5, np.nan, np.nan, np.nan, 2])
+
+
+def test_rolling_min_max_nan_vs_brute_force():
+    x = np.round(np.random.normal(size=500) * 2)
+    x[::31] = np.nan
+    result = screamer_module.RollingMinMax(5)(x)
+    np.testing.assert_array_equal(result[:, 0], _brute_force_windows(x, 5, np.min))
+    np.testing.assert_array_equal(result[:, 1], _brute_force_windows(x, 5, np.max))
@@ -0,0 +1,27 @@
+from concurrent.futures import ThreadPoolExecutor
+import numpy as np
+from devtools import sii
+import pytest
+
+screamer_module = sii.load_screamer_module()
+
+
+@pytest.mark.parametrize("class_name, params", [
+    ("RollingQuantile", {"window_size": 50, "quantile": 0.3}),
+    ("RollingMedian", {"window_size": 50}),
+    ("RollingMean", {"window_size": 50}),
+    ("EwStd", {"span": 20}),
+])
+def test_threads_vs_serial(class_name, params):
+    """Arrays processed from concurrent Python threads match serial processing."""
+    screamer_class = getattr(screamer_module, class_name)
+    inputs = [np.random.normal(size=(10_000, 2)) for _ in range(8)]
+
+    expected = [screamer_class(**params)(x) for x in inputs]
+
+    # each thread uses its own object, objects themselves are not thread safe
+    with ThreadPoolExecutor(max_workers=4) as pool:
+        results = list(pool.map(lambda x: screamer_class(**params)(x), inputs))
+
+    for r, e in zip(results, expected):
+        np.testing.assert_array_equal(r, e)
@@ -0,0 +1,90 @@
+import numpy as np
+from .param_cases import yield_test_cases, generate_array
+from devtools import sii
+import pytest
+
+screamer_module = sii.load_screamer_module()
+
+
+def chunks(x, sizes):
+    """Split x into consecutive chunks with sizes cycling through sizes."""
+    i = 0
+    k = 0
+    while i < len(x):
+        n = sizes[k % len(sizes)]
+        yield x[i:i + n]
+        i += n
+        k += 1
+
+
+# Create a pytest parameterization using the collected test cases
+@pytest.mark.parametrize(
+    "class_name, params, array_type, array_length",
+    yield_test_cases()
+)
+def test_screamer_update(class_name, params, array_type, array_length):
+    """Processing a series in chunks with update() is identical to value by value streaming."""
+
+    # Get screamer class
+    screamer_class = getattr(screamer_module, class_name, None)
+
+    # Instantiate the screamer objects
+    screamer_instance_1 = screamer_class(**params)
+    screamer_instance_2 = screamer_class(**params)
+
+    input_array = generate_array(array_type, array_length)
+
+    # Run the streaming version
+    screamer_output_1 = np.array([screamer_instance_1(x) for x in input_array])
+
+    # Run the chunked version, including empty chunks
+    screamer_output_2 = np.concatenate([
+        screamer_instance_2.update(c) for c in chunks(input_array, [1, 7, 0, 30, 2])
+    ])
+
+    np.testing.assert_array_equal(
+        screamer_output_1, screamer_output_2,
+        err_msg=f"Results do not match for {class_name}  with params {params} and array type '{array_type}' of length {array_length}"
+    )
+
+    # The state carries over to the next chunk, also for strided views and out=
+    screamer_instance_1.reset()
+    screamer_instance_2.reset()
+    strided = generate_array(array_type, 2 * array_length)[::2]
+
+    screamer_output_1 = np.array([screamer_instance_1(x) for x in strided])
+    screamer_output_2 = np.empty_like(strided)
+    half = array_length // 2
+    screamer_instance_2.update(strided[:half], out=screamer_output_2[:half])
+    screamer_instance_2.update(strided[half:], out=screamer_output_2[half:])
+
+    np.testing.assert_array_equal(screamer_output_1, screamer_output_2)
+
+
+def test_screamer_update_scalar():
+    """update() of scalars of all supported types matches scalar streaming."""
+
+    screamer_instance_1 = screamer_module.EwMean(span=5)
+    screamer_instance_2 = screamer_module.EwMean(span=5)
+
+    values = [1.5, 2, True, np.float64(-0.5), np.float32(3.25), np.int32(4), np.uint64(7), np.float16(0.5)]
+    for value in values:
+        result = screamer_instance_2.update(value)
+        assert isinstance(result, float)
+        assert result == screamer_instance_1(float(value))
+        assert screamer_instance_1(value) == screamer_instance_2(value)
+
+
+def test_screamer_update_errors():
+    """update() only accepts scalars and 1-dimensional arrays."""
+
+    screamer_instance = screamer_module.RollingMean(5)
+
+    with pytest.raises(ValueError):
+        screamer_instance.update(np.zeros((10, 2)))
+
+    with pytest.raises(ValueError):
+        screamer_instance.update("1.0")
+
+    with pytest.raises(ValueError):
+        screamer_instance.update(1.0, out=np.zeros(1))